@@ -0,0 +1,89 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2023 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.1
+ *
+ * Project:      Flash Dump Interface for ST STM32H5xx Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.1
+ *    A call ends at the last sector boundary within sz
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/* Note:
+   Dump(adr, sz, ctl) reads flash from adr and writes a compressed token
+   stream into the SRAM buffer ctl->out. It returns the address where the
+   next call continues (adr + sz when the range is complete). The host
+   reads ctl->outLen bytes after each call and appends them; the tokens of
+   all calls from ctl->base form one stream:
+     0x00..0x7F  literal:  T + 1 bytes follow
+     0x80..0xBF  match:    copy (T & 0x3F) + 4 bytes from 'offset' bytes
+                           back in the decoded data (2 bytes LE follow)
+     0xC0..0xFE  fill:     ((T & 0x3F) + 1) * 16 bytes of the value that follows
+     0xFF        same:     sector (FLASH_DUMP_SECTOR bytes) matches its digest
+   With ctl->nDigest != 0, ctl->digest points to one FNV-1a digest per
+   sector from ctl->base (sector aligned); matching sectors are emitted
+   as a single 'same' token. Matches never reach before ctl->base and no
+   token, literal runs included, crosses a sector boundary. A call with
+   adr == ctl->base starts a new stream and forgets earlier match positions,
+   so the output depends only on the flash content (see Utilities/Flash).
+   A call ends at the last sector boundary within adr + sz (or at adr + sz
+   when there is none), so the stream does not depend on sz as long as sz
+   spans a sector boundary. The host limits sz so that a call completes
+   within its timeout. */
+
+#ifndef FLASHDUMP_H_
+#define FLASHDUMP_H_
+
+#define FLASH_DUMP_LIT          (0x00U)    /* literal token */
+#define FLASH_DUMP_MATCH        (0x80U)    /* match token */
+#define FLASH_DUMP_FILL         (0xC0U)    /* fill token */
+#define FLASH_DUMP_SAME         (0xFFU)    /* sector same as digest */
+
+#define FLASH_DUMP_LIT_MAX      (128U)     /* longest literal run */
+#define FLASH_DUMP_MATCH_MIN    (4U)       /* shortest match */
+#define FLASH_DUMP_MATCH_MAX    (67U)      /* longest match */
+#define FLASH_DUMP_FILL_MAX     (1008U)    /* longest fill (63 * 16) */
+#define FLASH_DUMP_OFFSET_MAX   (0xFFFFU)  /* farthest match */
+
+#define FLASH_DUMP_SECTOR       (0x2000U)  /* Digest granularity (8K sector) */
+#define FLASH_DUMP_OUT_MIN      (256U)     /* Minimum output buffer size */
+
+#define FLASH_DUMP_LZ           (1U << 0)  /* flags: search matches (else fill/literal only) */
+
+#define FLASH_DUMP_FNV_BASIS    (0x811C9DC5U)
+#define FLASH_DUMP_FNV_PRIME    (0x01000193U)
+
+typedef struct {
+  unsigned int base;                       /* Start address of the dump (sector aligned) */
+  unsigned int flags;                      /* FLASH_DUMP_LZ */
+  unsigned int out;                        /* Output buffer address (SRAM) */
+  unsigned int outSize;                    /* Output buffer size in bytes */
+  unsigned int outLen;                     /* Output bytes of the last call (target) */
+  unsigned int digest;                     /* Address of the digest list, one per sector */
+  unsigned int nDigest;                    /* Number of digests, 0 = none */
+  unsigned int reserved;
+} FlashDump_t;
+
+#endif /* FLASHDUMP_H_ */
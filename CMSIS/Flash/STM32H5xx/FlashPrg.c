@@ -18,176 +18,52 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  *
- * $Date:        02. February 2023
- * $Revision:    V1.0.0
+ * $Date:        19. October 2026
+ * $Revision:    V1.5.1
  *
  * Project:      Flash Programming Functions for ST STM32H5xx Flash
  * --------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.5.1
+ *    HDP area only blocked when hidden at the current HDP level,
+ *    bank number follows SWAP_BANK, host test build (FLASH_HOST),
+ *    ProgramStream rejects a misaligned ring read index,
+ *    Dump calls end at a sector boundary (stream independent of sz)
+ *  Version 1.5.0
+ *    Added inline CRC-32 of programmed data (FlashCrcMode, FlashCrc) and CrcRange
+ *  Version 1.4.0
+ *    Added Dump (compressed flash read-out with sector digests)
+ *  Version 1.3.0
+ *    Added ProgramStream (halt-free programming from a SRAM ring buffer)
+ *  Version 1.2.0
+ *    Register definitions moved to FlashReg.h (shared with IAP library)
+ *  Version 1.1.0
+ *    Added protection scan in Init (WRP, HDP, secure watermark, EDATA)
  *  Version 1.0.0
  *    Initial release
  */
 
 /* Note:
    Flash has 8K sector size.
-   STM32H5xx devices have Dual Bank Flash configuration. */
+   STM32H5xx devices have Dual Bank Flash configuration.
+   ProgramStream, Dump, CrcRange and the inline CRC (FlashCrcMode, FlashCrc)
+   are only built with FLASH_EXT defined, as in all FLM targets of
+   STM32H5xx.uvprojx.
+   FLASH_HOST builds the functions for host tests (Utilities/Flash/FlashPrgTest.c),
+   which provide DSB(), NOP() and __disable_irq(). */
 
 #include "..\FlashOS.h"        /* FlashOS Structures */
+#include "FlashReg.h"          /* Flash Register Definitions */
+#include "FlashStream.h"       /* Flash Streaming Interface */
+#include "FlashDump.h"         /* Flash Dump Interface */
 
-typedef volatile unsigned long    vu32;
-typedef          unsigned long     u32;
-
-#define M32(adr) (*((vu32 *) (adr)))
-
-// Peripheral Memory Map
-#define FLASH_BASE       (0x40022000)
-#define DBGMCU_BASE      (0xE0044000)
-#define FLASHSIZE_BASE   (0x08FFF80C)
-
-#define FLASH           ((FLASH_TypeDef  *) FLASH_BASE)
-#define DBGMCU          ((DBGMCU_TypeDef *) DBGMCU_BASE)
-
-// Debug MCU
-typedef struct {
-  vu32 IDCODE;
-} DBGMCU_TypeDef;
-
-// Flash Registers
-typedef struct
-{
-  vu32 ACR;             /*!< FLASH access control register,                                     Address offset: 0x00 */
-  vu32 NSKEYR;          /*!< FLASH non-secure key register,                                     Address offset: 0x04 */
-  vu32 SECKEYR;         /*!< FLASH secure key register,                                         Address offset: 0x08 */
-  vu32 OPTKEYR;         /*!< FLASH option key register,                                         Address offset: 0x0C */
-  vu32 NSOBKKEYR;       /*!< FLASH non-secure option bytes keys key register,                   Address offset: 0x10 */
-  vu32 SECOBKKEYR;      /*!< FLASH secure option bytes keys key register,                       Address offset: 0x14 */
-  vu32 OPSR;            /*!< FLASH OPSR register,                                               Address offset: 0x18 */
-  vu32 OPTCR;           /*!< Flash Option Control Register,                                     Address offset: 0x1C */
-  vu32 NSSR;            /*!< FLASH non-secure status register,                                  Address offset: 0x20 */
-  vu32 SECSR;           /*!< FLASH secure status register,                                      Address offset: 0x24 */
-  vu32 NSCR;            /*!< FLASH non-secure control register,                                 Address offset: 0x28 */
-  vu32 SECCR;           /*!< FLASH secure control register,                                     Address offset: 0x2C */
-  vu32 NSCCR;           /*!< FLASH non-secure clear control register,                           Address offset: 0x30 */
-  vu32 SECCCR;          /*!< FLASH secure clear control register,                               Address offset: 0x34 */
-  vu32 RESERVED1;       /*!< Reserved1,                                                         Address offset: 0x38 */
-  vu32 PRIVCFGR;        /*!< FLASH privilege configuration register,                            Address offset: 0x3C */
-  vu32 NSOBKCFGR;       /*!< FLASH non-secure option byte key configuration register,           Address offset: 0x40 */
-  vu32 SECOBKCFGR;      /*!< FLASH secure option byte key configuration register,               Address offset: 0x44 */
-  vu32 HDPEXTR;         /*!< FLASH HDP extension register,                                      Address offset: 0x48 */
-  vu32 RESERVED2;       /*!< Reserved2,                                                         Address offset: 0x4C */
-  vu32 OPTSR_CUR;       /*!< FLASH option status current register,                              Address offset: 0x50 */
-  vu32 OPTSR_PRG;       /*!< FLASH option status to program register,                           Address offset: 0x54 */
-  vu32 RESERVED3[2];    /*!< Reserved3,                                                         Address offset: 0x58-0x5C */
-  vu32 NSEPOCHR_CUR;    /*!< FLASH non-secure epoch current register,                           Address offset: 0x60 */
-  vu32 NSEPOCHR_PRG;    /*!< FLASH non-secure epoch to program register,                        Address offset: 0x64 */
-  vu32 SECEPOCHR_CUR;   /*!< FLASH secure epoch current register,                               Address offset: 0x68 */
-  vu32 SECEPOCHR_PRG;   /*!< FLASH secure epoch to program register,                            Address offset: 0x6C */
-  vu32 OPTSR2_CUR;      /*!< FLASH option status current register 2,                            Address offset: 0x70 */
-  vu32 OPTSR2_PRG;      /*!< FLASH option status to program register 2,                         Address offset: 0x74 */
-  vu32 RESERVED4[2];    /*!< Reserved4,                                                         Address offset: 0x78-0x7C */
-  vu32 NSBOOTR_CUR;     /*!< FLASH non-secure unique boot entry current register,               Address offset: 0x80 */
-  vu32 NSBOOTR_PRG;     /*!< FLASH non-secure unique boot entry to program register,            Address offset: 0x84 */
-  vu32 SECBOOTR_CUR;    /*!< FLASH secure unique boot entry current register,                   Address offset: 0x88 */
-  vu32 SECBOOTR_PRG;    /*!< FLASH secure unique boot entry to program register,                Address offset: 0x8C */
-  vu32 OTPBLR_CUR;      /*!< FLASH OTP block lock current register,                             Address offset: 0x90 */
-  vu32 OTPBLR_PRG;      /*!< FLASH OTP block Lock to program register,                          Address offset: 0x94 */
-  vu32 WRP12R_CUR;      /*!< FLASH write sector group 1 protection for Bank2 current register    Address offset: 0x98 */
-  vu32 WRP12R_PRG;      /*!< FLASH write sector group 1 protection for Bank2 to program register Address offset: 0x9C */
-  vu32 SECBB1R1;        /*!< FLASH secure block-based bank 1 register 1,                        Address offset: 0xA0 */
-  vu32 SECBB1R2;        /*!< FLASH secure block-based bank 1 register 2,                        Address offset: 0xA4 */
-  vu32 SECBB1R3;        /*!< FLASH secure block-based bank 1 register 3,                        Address offset: 0xA8 */
-  vu32 SECBB1R4;        /*!< FLASH secure block-based bank 1 register 4,                        Address offset: 0xAC */
-  vu32 SECBB1R5;        /*!< FLASH secure block-based bank 1 register 5,                        Address offset: 0xB0 */
-  vu32 SECBB1R6;        /*!< FLASH secure block-based bank 1 register 6,                        Address offset: 0xB4 */
-  vu32 SECBB1R7;        /*!< FLASH secure block-based bank 1 register 7,                        Address offset: 0xB8 */
-  vu32 SECBB1R8;        /*!< FLASH secure block-based bank 1 register 8,                        Address offset: 0xBC */
-  vu32 PRIVBB1R1;       /*!< FLASH privilege block-based bank 1 register 1,                     Address offset: 0xC0 */
-  vu32 PRIVBB1R2;       /*!< FLASH privilege block-based bank 1 register 2,                     Address offset: 0xC4 */
-  vu32 PRIVBB1R3;       /*!< FLASH privilege block-based bank 1 register 3,                     Address offset: 0xC8 */
-  vu32 PRIVBB1R4;       /*!< FLASH privilege block-based bank 1 register 4,                     Address offset: 0xCC */
-  vu32 PRIVBB1R5;       /*!< FLASH privilege block-based bank 1 register 5,                     Address offset: 0xD0 */
-  vu32 PRIVBB1R6;       /*!< FLASH privilege block-based bank 1 register 6,                     Address offset: 0xD4 */
-  vu32 PRIVBB1R7;       /*!< FLASH privilege block-based bank 1 register 7,                     Address offset: 0xD8 */
-  vu32 PRIVBB1R8;       /*!< FLASH privilege block-based bank 1 register 8,                     Address offset: 0xDC */
-  vu32 SECWM1R_CUR;     /*!< FLASH secure watermark 1 current register,                         Address offset: 0xE0 */
-  vu32 SECWM1R_PRG;     /*!< FLASH secure watermark 1 to program register,                      Address offset: 0xE4 */
-  vu32 WRP11R_CUR;      /*!< FLASH write sector group protection current register for bank1,    Address offset: 0xE8 */
-  vu32 WRP11R_PRG;      /*!< FLASH write sector group protection to program register for bank1, Address offset: 0xEC */
-  vu32 EDATA1R_CUR;     /*!< FLASH data sectors configuration current register for bank1,       Address offset: 0xF0 */
-  vu32 EDATA1R_PRG;     /*!< FLASH data sectors configuration to program register for bank1,    Address offset: 0xF4 */
-  vu32 HDP1R_CUR;       /*!< FLASH HDP configuration current register for bank1,                Address offset: 0xF8 */
-  vu32 HDP1R_PRG;       /*!< FLASH HDP configuration to program register for bank1,             Address offset: 0xFC */
-  vu32 ECCCORR;         /*!< FLASH ECC correction register,                                     Address offset: 0x100 */
-  vu32 ECCDETR;         /*!< FLASH ECC detection register,                                      Address offset: 0x104 */
-  vu32 ECCDR;           /*!< FLASH ECC data register,                                           Address offset: 0x108 */
-  vu32 RESERVED8[35];   /*!< Reserved8,                                                         Address offset: 0x10C-0x194 */
-  vu32 WRP22R_CUR;      /*!< FLASH write sector group 2 protection for Bank2 current register    Address offset: 0x198 */
-  vu32 WRP22R_PRG;      /*!< FLASH write sector group 2 protection for Bank2 to program register Address offset: 0x19C */
-  vu32 SECBB2R1;        /*!< FLASH secure block-based bank 2 register 1,                        Address offset: 0x1A0 */
-  vu32 SECBB2R2;        /*!< FLASH secure block-based bank 2 register 2,                        Address offset: 0x1A4 */
-  vu32 SECBB2R3;        /*!< FLASH secure block-based bank 2 register 3,                        Address offset: 0x1A8 */
-  vu32 SECBB2R4;        /*!< FLASH secure block-based bank 2 register 4,                        Address offset: 0x1AC */
-  vu32 SECBB2R5;        /*!< FLASH secure block-based bank 2 register 5,                        Address offset: 0x1B0 */
-  vu32 SECBB2R6;        /*!< FLASH secure block-based bank 2 register 6,                        Address offset: 0x1B4 */
-  vu32 SECBB2R7;        /*!< FLASH secure block-based bank 2 register 7,                        Address offset: 0x1B8 */
-  vu32 SECBB2R8;        /*!< FLASH secure block-based bank 2 register 8,                        Address offset: 0x1BC */
-  vu32 PRIVBB2R1;       /*!< FLASH privilege block-based bank 2 register 1,                     Address offset: 0x1C0 */
-  vu32 PRIVBB2R2;       /*!< FLASH privilege block-based bank 2 register 2,                     Address offset: 0x1C4 */
-  vu32 PRIVBB2R3;       /*!< FLASH privilege block-based bank 2 register 3,                     Address offset: 0x1C8 */
-  vu32 PRIVBB2R4;       /*!< FLASH privilege block-based bank 2 register 4,                     Address offset: 0x1CC */
-  vu32 PRIVBB2R5;       /*!< FLASH privilege block-based bank 2 register 5,                     Address offset: 0x1D0 */
-  vu32 PRIVBB2R6;       /*!< FLASH privilege block-based bank 2 register 6,                     Address offset: 0x1D4 */
-  vu32 PRIVBB2R7;       /*!< FLASH privilege block-based bank 2 register 7,                     Address offset: 0x1D8 */
-  vu32 PRIVBB2R8;       /*!< FLASH privilege block-based bank 2 register 8,                     Address offset: 0x1DC */
-  vu32 SECWM2R_CUR;     /*!< FLASH secure watermark 2 current register,                         Address offset: 0x1E0 */
-  vu32 SECWM2R_PRG;     /*!< FLASH secure watermark 2 to program register,                      Address offset: 0x1E4 */
-  vu32 WRP21R_CUR;       /*!< FLASH write sector group protection current register for bank2,    Address offset: 0x1E8 */
-  vu32 WRP21R_PRG;       /*!< FLASH write sector group protection to program register for bank2, Address offset: 0x1EC */
-  vu32 EDATA2R_CUR;     /*!< FLASH data sectors configuration current register for bank2,       Address offset: 0x1F0 */
-  vu32 EDATA2R_PRG;     /*!< FLASH data sectors configuration to program register for bank2,    Address offset: 0x1F4 */
-  vu32 HDP2R_CUR;       /*!< FLASH HDP configuration current register for bank2,                Address offset: 0x1F8 */
-  vu32 HDP2R_PRG;       /*!< FLASH HDP configuration to program register for bank2,             Address offset: 0x1FC */
-} FLASH_TypeDef;
-// Flash Keys
-#define FLASH_KEY1               0x45670123
-#define FLASH_KEY2               0xCDEF89AB
-#define FLASH_OPTKEY1            0x08192A3B
-#define FLASH_OPTKEY2            0x4C5D6E7F
-
-// Flash Control Register definitions
-#define FLASH_CR_LOCK           ((u32)(  1U      ))
-#define FLASH_CR_PG             ((u32)(  1U <<  1))
-#define FLASH_CR_SER            ((u32)(  1U <<  2))
-#define FLASH_CR_BER            ((u32)(  1U <<  3))
-#define FLASH_CR_FW             ((u32)(  1U <<  4))
-#define FLASH_CR_STRT           ((u32)(  1U <<  5))
-#define FLASH_CR_PNB_MSK        ((u32)(0x7F <<  6))
-#define FLASH_CR_MER            ((u32)(  1U << 15))
-#define FLASH_CR_BKSEL          ((u32)(  1U << 31))
-
-
-// Flash Status Register definitions
-#define FLASH_SR_BSY            ((u32)(  1U      ))
-#define FLASH_SR_WBNE           ((u32)(  1U <<  1))
-#define FLASH_SR_DBNE           ((u32)(  1U <<  3))
-#define FLASH_SR_EOP            ((u32)(  1U << 16))
-#define FLASH_SR_WRPERR         ((u32)(  1U << 17))
-#define FLASH_SR_PGSERR         ((u32)(  1U << 18))
-#define FLASH_SR_STRBERR        ((u32)(  1U << 19))
-#define FLASH_SR_INCERR         ((u32)(  1U << 20))
-#define FLASH_SR_OBKERR         ((u32)(  1U << 21))
-#define FLASH_SR_OBKWERR        ((u32)(  1U << 22))
-#define FLASH_SR_OPTCHANGEERR   ((u32)(  1U << 23))
-
-// Flash option register definitions
-#define FLASH_OPTR_RDP          ((u32)(0xFF      ))
-#define FLASH_OPTR_RDP_NO       ((u32)(0xAA      ))
-#define FLASH_OPTR_TZEN         ((u32)(0xFF000000))
-
-
-#define FLASH_PGERR             (FLASH_SR_WRPERR | FLASH_SR_STRBERR | FLASH_SR_PGSERR | \
-                                 FLASH_SR_INCERR | FLASH_SR_OBKERR  | FLASH_SR_OBKWERR)
+// Sector protection reasons (content of gFlashProt[])
+#define FLASH_PROT_NONE         (0U)                     /* sector can be erased/programmed */
+#define FLASH_PROT_WRP          (1U)                     /* write protected sector group */
+#define FLASH_PROT_HDP          (2U)                     /* hide protection area (incl. extension) */
+#define FLASH_PROT_SECWM        (3U)                     /* secure watermark area, non-secure alias */
+#define FLASH_PROT_EDATA        (4U)                     /* configured as high-cycle data area */
 
 #if defined FLASH_MEM
 static u32 gFlashBase;                  /* Flash base address */
@@ -197,8 +73,23 @@ static vu32 *pFlashCR;                  /* Pointer to Flash Control register */
 static vu32 *pFlashSR;                  /* Pointer to Flash Status register */
 static vu32 *pFlashCCR;                 /* Pointer to Flash Clear Control register */
 static vu32 *pFlashkey;
+
+static unsigned char gFlashProt[FLASH_SECTOR_MAX];  /* Protection reason per sector */
+
+/* Last rejected operation, readable by the debugger via symbol */
+volatile u32 FlashProtAdr;                          /* Address of the blocked sector */
+volatile u32 FlashProtReason;                       /* FLASH_PROT_xxx of the blocked sector */
+
+/* Inline CRC-32 (IEEE 802.3, as zlib crc32), set/read by the debugger via symbol */
+#if defined FLASH_EXT
+volatile u32 FlashCrcMode;                          /* 1 = ProgramPage/ProgramStream update FlashCrc */
+volatile u32 FlashCrc;                              /* CRC-32 of all quad-words programmed since Init */
+
+static u32 gCrcTab[256];                            /* CRC-32 table, built on first use */
+#endif /* FLASH_EXT */
 #endif /* FLASH_MEM */
 
+#if !defined FLASH_HOST
 static void DSB(void)
 {
   __asm ("dsb");
@@ -208,6 +99,7 @@ static void NOP(void)
 {
   __asm ("nop");
 }
+#endif /* FLASH_HOST */
 
 // Helper macro: set N block-based secure registers of a bank to value
 #define SET_FLASH_SECBB(bank, count, value)     \
@@ -226,22 +118,32 @@ static void NOP(void)
        defined(STM32H5xx_256_0x08)  || defined(STM32H5xx_256_0x0C)
 
   #define SECBB_REG_COUNT   1U    /* 256K / 512K */
+  #define WRP_GRP_SECTORS   1U    /* 1 sector per WRPSG bit */
+
+#elif  defined(STM32H503_128K_0x08)
+
+  #define SECBB_REG_COUNT   1U    /* 128K, no TrustZone */
+  #define WRP_GRP_SECTORS   1U
 
 #elif  defined(STM32H5xx_1024_0x08) || defined(STM32H5xx_1024_0x0C)
 
   #define SECBB_REG_COUNT   2U    /* 1M */
+  #define WRP_GRP_SECTORS   4U    /* 4 sectors per WRPSG bit */
 
 #elif  defined(STM32H5xx_2048_0x08) || defined(STM32H5xx_2048_0x0C)
 
   #define SECBB_REG_COUNT   4U    /* 2M */
+  #define WRP_GRP_SECTORS   4U
 
 #elif  defined(STM32H5xx_3072_0x08) || defined(STM32H5xx_3072_0x0C)
 
   #define SECBB_REG_COUNT   6U    /* 3M */
+  #define WRP_GRP_SECTORS   4U    /* WRPx2R holds groups 32..63 */
 
 #elif  defined(STM32H5xx_4096_0x08) || defined(STM32H5xx_4096_0x0C)
 
   #define SECBB_REG_COUNT   8U    /* 4M */
+  #define WRP_GRP_SECTORS   4U    /* WRPx2R holds groups 32..63 */
 
 #else
   #error "Unsupported STM32H5xx flash size define"
@@ -250,10 +152,12 @@ static void NOP(void)
 #define sec_value 0xFFFFFFFFU
 
 
+#if !defined FLASH_HOST
 static void __disable_irq(void)
 {
   __asm volatile ("cpsid i" : : : "memory");
 }
+#endif /* FLASH_HOST */
 
 
 /*
@@ -318,7 +222,8 @@ static u32 GetFlashBankMode (void) {
  * Get Flash Bank Number
  *    Parameter:      adr:  Sector Address
  *    Return Value:   Bank Number (0..1)
- *                    Flash bank size is always the half of the Flash size
+ *                    Flash bank size is always the half of the Flash size,
+ *                    with SWAP_BANK set bank 2 is mapped at the Flash base
  */
 
 #if defined FLASH_MEM
@@ -339,6 +244,10 @@ static u32 GetFlashBankNum(u32 adr) {
       {
         flashBankNum = 0U;
       }
+      if (FLASH->OPTSR_CUR & FLASH_OPTSR_SWAP_BANK)
+      {
+        flashBankNum ^= 1U;                              /* Banks swapped */
+      }
     }
     else
     {
@@ -427,6 +336,191 @@ static u32 GetFlashPageSize (void)
 #endif /* FLASH_MEM */
 
 
+/*
+ * Get Hide Protection Level
+ *    Return Value:   0..3 = HDPL0..HDPL3
+ *                    an unknown level is treated as HDPL3
+ */
+
+#if defined FLASH_MEM
+static u32 GetHdpLevel (void) {
+  u32 hdpl;
+
+  switch (SBS->HDPLSR & SBS_HDPL_MSK)
+  {
+    case SBS_HDPL_0: hdpl = 0U; break;
+    case SBS_HDPL_1: hdpl = 1U; break;
+    case SBS_HDPL_2: hdpl = 2U; break;
+    default:         hdpl = 3U; break;
+  }
+
+  return (hdpl);
+}
+#endif /* FLASH_MEM */
+
+
+/*
+ * Mark Flash sector range with protection reason
+ *    Parameter:      bank: Bank Number (0..1)
+ *                    strt: first Sector in Bank
+ *                    end:  last Sector in Bank
+ *                    prot: protection reason (FLASH_PROT_xxx)
+ *                    Already marked sectors keep their first reason
+ */
+
+#if defined FLASH_MEM
+static void SetFlashProt (u32 bank, u32 strt, u32 end, u32 prot) {
+  u32 nSect = (gFlashSize >> 1) >> FLASH_SECTOR_SHIFT;  /* sectors per bank */
+
+  if (end >= nSect) {
+    end = nSect - 1U;
+  }
+
+  for (; strt <= end; strt++) {
+    if (gFlashProt[(bank * nSect) + strt] == FLASH_PROT_NONE) {
+      gFlashProt[(bank * nSect) + strt] = (unsigned char)prot;
+    }
+  }
+}
+#endif /* FLASH_MEM */
+
+
+/*
+ * Scan Flash protection
+ *    Decodes WRP, HDP, secure watermark and EDATA configuration of
+ *    both banks into gFlashProt[] so that EraseSector/ProgramPage
+ *    can reject blocked sectors without starting a Flash operation.
+ *    gFlashProt[] is indexed by physical bank (see GetFlashBankNum).
+ */
+
+#if defined FLASH_MEM
+static void ScanFlashProt (void) {
+  u32 nSect = (gFlashSize >> 1) >> FLASH_SECTOR_SHIFT;  /* sectors per bank */
+  u32 hdpl  = GetHdpLevel();
+  u32 bank, sect;
+  u32 wrp1, wrp2, hdp, hdpExt, secwm, edata;
+  u32 strt, end;
+
+  for (sect = 0U; sect < FLASH_SECTOR_MAX; sect++) {
+    gFlashProt[sect] = FLASH_PROT_NONE;
+  }
+
+  for (bank = 0U; bank < 2U; bank++) {
+    if (bank == 0U) {
+      wrp1   = FLASH->WRP11R_CUR;
+      wrp2   = FLASH->WRP12R_CUR;
+      hdp    = FLASH->HDP1R_CUR;
+      hdpExt =  FLASH->HDPEXTR        & FLASH_HDPEXT_MSK;
+      secwm  = FLASH->SECWM1R_CUR;
+      edata  = FLASH->EDATA1R_CUR;
+    } else {
+      wrp1   = FLASH->WRP21R_CUR;
+      wrp2   = FLASH->WRP22R_CUR;
+      hdp    = FLASH->HDP2R_CUR;
+      hdpExt = (FLASH->HDPEXTR >> 16) & FLASH_HDPEXT_MSK;
+      secwm  = FLASH->SECWM2R_CUR;
+      edata  = FLASH->EDATA2R_CUR;
+    }
+
+    /* Write protection: WRPSG bit cleared = sector group protected */
+    for (sect = 0U; sect < nSect; sect += WRP_GRP_SECTORS) {
+      u32 grp = sect / WRP_GRP_SECTORS;
+      u32 wrp = (grp < 32U) ? wrp1 : wrp2;
+
+      if ((wrp & (1U << (grp & 31U))) == 0U) {
+        SetFlashProt(bank, sect, sect + WRP_GRP_SECTORS - 1U, FLASH_PROT_WRP);
+      }
+    }
+
+    /* HDP area (start <= end) is hidden from HDPL2 on, the HDP extension
+       behind the area from HDPL3 on. At HDPL0/1 (after reset) both are writable */
+    strt =  hdp & FLASH_AREA_STRT_MSK;
+    end  = (hdp & FLASH_AREA_END_MSK) >> FLASH_AREA_END_POS;
+    if ((strt <= end) && (hdpl >= 2U)) {
+      SetFlashProt(bank, strt, (hdpl >= 3U) ? (end + hdpExt) : end, FLASH_PROT_HDP);
+    }
+
+    /* Secure watermark area is not writable through the non-secure alias */
+    if ((GetFlashSecureMode() == 1U) && ((gFlashBase & 0x04000000) == 0U)) {
+      strt =  secwm & FLASH_AREA_STRT_MSK;
+      end  = (secwm & FLASH_AREA_END_MSK) >> FLASH_AREA_END_POS;
+      if (strt <= end) {
+        SetFlashProt(bank, strt, end, FLASH_PROT_SECWM);
+      }
+    }
+
+    /* EDATA: last (EDATA_STRT + 1) sectors of the bank are high-cycle data area */
+    if (edata & FLASH_EDATA_EN) {
+      strt = nSect - ((edata & FLASH_EDATA_STRT_MSK) + 1U);
+      SetFlashProt(bank, strt, nSect - 1U, FLASH_PROT_EDATA);
+    }
+  }
+}
+#endif /* FLASH_MEM */
+
+
+/*
+ * Check Flash protection of an address range
+ *    Parameter:      adr:  Start Address
+ *                    sz:   Size (in bytes)
+ *    Return Value:   0 = all sectors writable
+ *                    1 = blocked (FlashProtAdr, FlashProtReason are set)
+ */
+
+#if defined FLASH_MEM
+static u32 CheckFlashProt (u32 adr, u32 sz) {
+  u32 nSect = (gFlashSize >> 1) >> FLASH_SECTOR_SHIFT;  /* sectors per bank */
+  u32 end   = adr + sz;
+  u32 sect;
+
+  adr &= ~((1U << FLASH_SECTOR_SHIFT) - 1U);
+  do {
+    sect = (GetFlashBankNum(adr) * nSect) + GetFlashPageNum(adr);
+    if ((sect < FLASH_SECTOR_MAX) && (gFlashProt[sect] != FLASH_PROT_NONE)) {
+      FlashProtAdr    = adr;
+      FlashProtReason = gFlashProt[sect];
+      return (1U);
+    }
+    adr += (1U << FLASH_SECTOR_SHIFT);
+  } while (adr < end);
+
+  return (0U);
+}
+#endif /* FLASH_MEM */
+
+
+/*
+ *  Update CRC-32 (reflected, polynomial 0xEDB88320)
+ *    Parameter:      crc:  CRC of the preceding data (0 for start)
+ *                    buf:  Data
+ *                    sz:   Size (in bytes)
+ *    Return Value:   CRC including buf
+ */
+
+#if defined FLASH_MEM && defined FLASH_EXT
+static u32 Crc32 (u32 crc, const unsigned char *buf, u32 sz)
+{
+  u32 i, j, c;
+
+  if (gCrcTab[1] == 0U) {                                /* Build table once */
+    for (i = 0U; i < 256U; i++) {
+      c = i;
+      for (j = 0U; j < 8U; j++) {
+        c = (c & 1U) ? ((c >> 1) ^ 0xEDB88320U) : (c >> 1);
+      }
+      gCrcTab[i] = c;
+    }
+  }
+
+  crc = ~crc;
+  while (sz--) {
+    crc = gCrcTab[(crc ^ *buf++) & 0xFFU] ^ (crc >> 8);
+  }
+  return (~crc);
+}
+#endif /* FLASH_MEM && FLASH_EXT */
+
+
 /*
  *  Initialize Flash Programming Functions
  *    Parameter:      adr:  Device Base Address
@@ -500,6 +594,13 @@ int Init (unsigned long adr, unsigned long clk, unsigned long fnc)
   gFlashBase = adr;
   gFlashSize = (M32(FLASHSIZE_BASE) & 0x0000FFFF) << 10;
 #endif
+
+  FlashProtAdr    = 0U;
+  FlashProtReason = FLASH_PROT_NONE;
+#if defined FLASH_EXT
+  FlashCrc        = 0U;                                  /* Start inline CRC */
+#endif
+  ScanFlashProt();                                       /* Decode protection once */
 #endif /* FLASH_MEM */
 
 #if defined FLASH_OPT
@@ -572,6 +673,10 @@ int BlankCheck (unsigned long adr, unsigned long sz, unsigned char pat)
 #if defined FLASH_MEM
 int EraseChip (void)
 {
+  if (CheckFlashProt(gFlashBase, gFlashSize)) {          /* Mass erase fails on any protected sector */
+    return (1);                                          /* Failed */
+  }
+
   *pFlashCCR = FLASH_PGERR;                              /* Reset Error Flags */
 
   *pFlashCR  = FLASH_CR_MER;                             /* Bank A/B mass erase enabled */
@@ -604,6 +709,10 @@ int EraseSector (unsigned long adr)
 {
   u32 b, p;
 
+  if (CheckFlashProt(adr, 1U)) {                         /* Blocked sector, fail fast */
+    return (1);                                          /* Failed */
+  }
+
   b = GetFlashBankNum(adr);                              /* Get Bank Number 0..1  */
   p = GetFlashPageNum(adr);                              /* Get Page Number 0..127 */
 
@@ -639,6 +748,58 @@ int EraseSector (unsigned long adr) {
 #endif /* FLASH_OPT */
 
 
+/*
+ *  Program one quad-word, programming must be enabled (FLASH_CR_PG)
+ *    Parameter:      adr:  Quad-word Address
+ *                    buf:  Quad-word Data (any alignment)
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#if defined FLASH_MEM
+static int ProgramQuadWord (u32 adr, const unsigned char *buf)
+{
+//  M32(adr    ) = *((u32 *)(buf + 0));                    /* Program the 1st word of the quad-word */
+//  M32(adr + 4) = *((u32 *)(buf + 4));                    /* Program the 2nd word of the quad-word */
+//  M32(adr + 8) = *((u32 *)(buf + 8));                    /* Program the 3rd word of the quad-word */
+//  M32(adr +12) = *((u32 *)(buf +12));                    /* Program the 4th word of the quad-word */
+
+  M32(adr    ) = (u32)((*(buf+ 0)      ) |
+                       (*(buf+ 1) <<  8) |
+                       (*(buf+ 2) << 16) |
+                       (*(buf+ 3) << 24) );              /* Program the 1st word of the quad-word */
+  M32(adr + 4) = (u32)((*(buf+ 4)      ) |
+                       (*(buf+ 5) <<  8) |
+                       (*(buf+ 6) << 16) |
+                       (*(buf+ 7) << 24) );              /* Program the 2nd word of the quad-word */
+  M32(adr + 8) = (u32)((*(buf+ 8)      ) |
+                       (*(buf+ 9) <<  8) |
+                       (*(buf+10) << 16) |
+                       (*(buf+11) << 24) );              /* Program the 3rd word of the quad-word */
+  M32(adr +12) = (u32)((*(buf+12)      ) |
+                       (*(buf+13) <<  8) |
+                       (*(buf+14) << 16) |
+                       (*(buf+15) << 24) );              /* Program the 4th word of the quad-word */
+  DSB();
+
+#if defined FLASH_EXT
+  if (FlashCrcMode) {                                    /* While the quad-word is programmed */
+    FlashCrc = Crc32(FlashCrc, buf, 16U);
+  }
+#endif
+
+  while (*pFlashSR & FLASH_SR_BSY) NOP();                /* Wait until operation is finished */
+
+  if (*pFlashSR & FLASH_PGERR) {                         /* Check for Error */
+    *pFlashCCR  = FLASH_PGERR;                           /* Reset Error Flags */
+    *pFlashCR   = 0U;                                    /* Reset CR */
+    return (1);                                          /* Failed */
+  }
+
+  return (0);
+}
+#endif /* FLASH_MEM */
+
+
 /*
  *  Program Page in Flash Memory
  *    Parameter:      adr:  Page Start Address
@@ -653,6 +814,10 @@ int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf)
 
   sz = (sz + 15) & ~15U;                                 /* Adjust size for four words */
 
+  if (CheckFlashProt(adr, sz)) {                         /* Blocked sector, fail fast */
+    return (1);                                          /* Failed */
+  }
+
   while (*pFlashSR & FLASH_SR_BSY) NOP();                /* Wait until operation is finished */
 
   *pFlashCCR = FLASH_PGERR;                              /* Reset Error Flags */
@@ -661,33 +826,7 @@ int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf)
 
   while (sz)
   {
-//    M32(adr    ) = *((u32 *)(buf + 0));                  /* Program the 1st word of the quad-word */
-//    M32(adr + 4) = *((u32 *)(buf + 4));                  /* Program the 2nd word of the quad-word */
-//    M32(adr + 8) = *((u32 *)(buf + 8));                  /* Program the 3rd word of the quad-word */
-//    M32(adr +12) = *((u32 *)(buf +12));                  /* Program the 4th word of the quad-word */
-
-    M32(adr    ) = (u32)((*(buf+ 0)      ) |
-                         (*(buf+ 1) <<  8) |
-                         (*(buf+ 2) << 16) |
-                         (*(buf+ 3) << 24) );            /* Program the 1st word of the quad-word */
-    M32(adr + 4) = (u32)((*(buf+ 4)      ) |
-                         (*(buf+ 5) <<  8) |
-                         (*(buf+ 6) << 16) |
-                         (*(buf+ 7) << 24) );            /* Program the 2nd word of the quad-word */
-    M32(adr + 8) = (u32)((*(buf+ 8)      ) |
-                         (*(buf+ 9) <<  8) |
-                         (*(buf+10) << 16) |
-                         (*(buf+11) << 24) );            /* Program the 3rd word of the quad-word */
-    M32(adr +12) = (u32)((*(buf+12)      ) |
-                         (*(buf+13) <<  8) |
-                         (*(buf+14) << 16) |
-                         (*(buf+15) << 24) );            /* Program the 4th word of the quad-word */
-    DSB();
-
-    while (*pFlashSR & FLASH_SR_BSY) NOP();              /* Wait until operation is finished */
-
-    if (*pFlashSR & FLASH_PGERR) {                       /* Check for Error */
-      *pFlashCCR  = FLASH_PGERR;                         /* Reset Error Flags */
+    if (ProgramQuadWord(adr, buf)) {                     /* Program the quad-word */
       return (1);                                        /* Failed */
     }
 
@@ -703,6 +842,238 @@ int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf)
 #endif /* FLASH_MEM */
 
 
+/*
+ *  Program Flash Memory from a Ring Buffer (see FlashStream.h)
+ *    Parameter:      adr:  Start Address (quad-word aligned)
+ *                    sz:   Size (in bytes)
+ *                    ring: Ring Buffer Control Block in SRAM
+ *    Return Value:   0 - OK,  1 - Failed or Aborted
+ *    The host fills the ring while the core runs, no halt per page.
+ *    Sectors must be erased before.
+ */
+
+#if defined FLASH_MEM && defined FLASH_EXT
+int ProgramStream (unsigned long adr, unsigned long sz, FlashStream_t *ring)
+{
+  unsigned char *data = FLASH_STREAM_DATA(ring);
+  u32 mask = ring->size - 1U;
+  u32 rd   = ring->rd;
+
+  sz = (sz + 15) & ~15U;                                 /* Adjust size for four words */
+
+  if (((adr & 15U) != 0U) || ((rd & 15U) != 0U) || (ring->size < 16U) ||
+      ((ring->size & mask) != 0U) || ((ring->size & 15U) != 0U)) {
+    ring->errAdr = adr;
+    ring->state  = FLASH_STREAM_ERROR;
+    return (1);                                          /* Invalid stream */
+  }
+
+  if (CheckFlashProt(adr, sz)) {                         /* Blocked sector, fail fast */
+    ring->errAdr = FlashProtAdr;
+    ring->state  = FLASH_STREAM_ERROR;
+    return (1);                                          /* Failed */
+  }
+
+  while (*pFlashSR & FLASH_SR_BSY) NOP();                /* Wait until operation is finished */
+
+  *pFlashCCR = FLASH_PGERR;                              /* Reset Error Flags */
+
+  *pFlashCR = FLASH_CR_PG;                               /* Programming Enabled */
+
+  ring->state = FLASH_STREAM_RUN;
+
+  while (sz)
+  {
+    while ((ring->wr - rd) < 16U) {                      /* Wait for the next quad-word */
+      if (ring->cmd == FLASH_STREAM_ABORT) {
+        *pFlashCR   = 0U;                                /* Reset CR */
+        ring->state = FLASH_STREAM_ABORTED;
+        return (1);                                      /* Aborted */
+      }
+    }
+    DSB();                                               /* Data written before wr */
+
+    if (ProgramQuadWord(adr, &data[rd & mask])) {        /* Program the quad-word */
+      ring->errAdr = adr;
+      ring->state  = FLASH_STREAM_ERROR;
+      return (1);                                        /* Failed */
+    }
+
+    rd      += 16;
+    ring->rd = rd;                                       /* Release ring space */
+    adr     += 16;                                       /* Next quad-word */
+    sz      -= 16;
+  }
+
+  *pFlashCR   = 0U;                                      /* Reset CR */
+  ring->state = FLASH_STREAM_DONE;
+
+  return (0);
+}
+#endif /* FLASH_MEM && FLASH_EXT */
+
+
+/*
+ *  CRC-32 of Flash Contents (final check instead of Verify)
+ *    Parameter:      adr:  Start Address
+ *                    sz:   Size (in bytes)
+ *                    crc:  CRC of preceding ranges (0 for first range)
+ *    Return Value:   CRC including the range, compared by the host
+ *                    with the CRC of the image ranges
+ */
+
+#if defined FLASH_MEM && defined FLASH_EXT
+unsigned long CrcRange (unsigned long adr, unsigned long sz, unsigned long crc)
+{
+  return (Crc32(crc, (const unsigned char *)adr, sz));
+}
+#endif /* FLASH_MEM && FLASH_EXT */
+
+
+#if defined FLASH_MEM && defined FLASH_EXT
+#define DUMP_HASH_BITS  (10U)
+static u32 gDumpHash[1U << DUMP_HASH_BITS];              /* Last position per 4-byte hash */
+
+/* FNV-1a digest of a flash range */
+static u32 DumpDigest (u32 adr, u32 sz)
+{
+  u32 h = FLASH_DUMP_FNV_BASIS;
+
+  while (sz--) {
+    h = (h ^ *((unsigned char *)adr++)) * FLASH_DUMP_FNV_PRIME;
+  }
+  return (h);
+}
+
+/* Emit pending literals [lit, pos) */
+static u32 DumpLiteral (unsigned char *out, u32 lit, u32 pos)
+{
+  u32 n = pos - lit;
+  u32 i;
+
+  if (n == 0U) {
+    return (0U);
+  }
+  out[0] = (unsigned char)(FLASH_DUMP_LIT | (n - 1U));
+  for (i = 0U; i < n; i++) {
+    out[1U + i] = *((unsigned char *)(lit + i));
+  }
+  return (n + 1U);
+}
+#endif /* FLASH_MEM && FLASH_EXT */
+
+
+/*
+ *  Dump Flash Memory compressed (see FlashDump.h)
+ *    Parameter:      adr:  Start Address
+ *                    sz:   Size (in bytes)
+ *                    ctl:  Dump Control Block in SRAM
+ *    Return Value:   Address to continue, (adr+sz) - complete
+ *                    ctl->outLen = bytes in ctl->out
+ */
+
+#if defined FLASH_MEM && defined FLASH_EXT
+unsigned long Dump (unsigned long adr, unsigned long sz, FlashDump_t *ctl)
+{
+  unsigned char *out    = (unsigned char *)ctl->out;
+  const u32     *digest = (const u32 *)ctl->digest;
+  u32 base = ctl->base;
+  u32 end  = adr + sz;
+  u32 pos  = adr;
+  u32 lit  = adr;                                        /* Start of pending literals */
+  u32 o    = 0U;
+  u32 lim, idx, n, v, h, cand;
+
+  ctl->outLen = 0U;
+  if ((ctl->outSize < FLASH_DUMP_OUT_MIN) || (adr < base)) {
+    return (adr);                                        /* No progress */
+  }
+
+  lim = end - ((end - base) % FLASH_DUMP_SECTOR);        /* Last sector boundary of the call */
+  if (lim > adr) {
+    end = lim;                                           /* sz does not cut runs */
+  }
+
+  if (adr == base) {                                     /* New dump: forget earlier positions */
+    for (idx = 0U; idx < (1U << DUMP_HASH_BITS); idx++) {
+      gDumpHash[idx] = 0U;
+    }
+  }
+
+  while (pos < end) {
+    if ((ctl->outSize - o) < ((pos - lit) + 1U + 3U + 1U)) {
+      pos = lit;                                         /* Out of space, literals in next call */
+      break;
+    }
+
+    idx = (pos - base) / FLASH_DUMP_SECTOR;
+    lim = base + ((idx + 1U) * FLASH_DUMP_SECTOR);       /* Tokens end at the sector boundary */
+    if (lim > end) {
+      lim = end;
+    }
+
+    /* Sector identical to its digest */
+    if ((((pos - base) % FLASH_DUMP_SECTOR) == 0U) && (idx < ctl->nDigest) &&
+        ((end - pos) >= FLASH_DUMP_SECTOR) && (DumpDigest(pos, FLASH_DUMP_SECTOR) == digest[idx])) {
+      o  += DumpLiteral(&out[o], lit, pos);
+      out[o++] = FLASH_DUMP_SAME;
+      pos += FLASH_DUMP_SECTOR;
+      lit  = pos;
+      continue;
+    }
+
+    /* Fill: erased areas, padding */
+    v = *((unsigned char *)pos);
+    for (n = 1U; ((pos + n) < lim) && (n < FLASH_DUMP_FILL_MAX) && (*((unsigned char *)(pos + n)) == v); n++);
+    if (n >= 16U) {
+      n   &= ~15U;
+      o   += DumpLiteral(&out[o], lit, pos);
+      out[o++] = (unsigned char)(FLASH_DUMP_FILL | ((n / 16U) - 1U));
+      out[o++] = (unsigned char)v;
+      pos += n;
+      lit  = pos;
+      continue;
+    }
+
+    /* Match: earlier data with the same 4 bytes */
+    if (((ctl->flags & FLASH_DUMP_LZ) != 0U) && ((lim - pos) >= FLASH_DUMP_MATCH_MIN)) {
+      h    = (u32)((*((unsigned char *)(pos    ))      ) |
+                   (*((unsigned char *)(pos + 1)) <<  8) |
+                   (*((unsigned char *)(pos + 2)) << 16) |
+                   (*((unsigned char *)(pos + 3)) << 24) );
+      h    = (h * 0x9E3779B1U) >> (32U - DUMP_HASH_BITS);
+      cand = gDumpHash[h];
+      gDumpHash[h] = pos;
+      if ((cand >= base) && (cand < pos) && ((pos - cand) <= FLASH_DUMP_OFFSET_MAX)) {
+        for (n = 0U; ((pos + n) < lim) && (n < FLASH_DUMP_MATCH_MAX) &&
+                     (*((unsigned char *)(cand + n)) == *((unsigned char *)(pos + n))); n++);
+        if (n >= FLASH_DUMP_MATCH_MIN) {
+          o   += DumpLiteral(&out[o], lit, pos);
+          out[o++] = (unsigned char)(FLASH_DUMP_MATCH | (n - FLASH_DUMP_MATCH_MIN));
+          out[o++] = (unsigned char)((pos - cand)     );
+          out[o++] = (unsigned char)((pos - cand) >> 8);
+          pos += n;
+          lit  = pos;
+          continue;
+        }
+      }
+    }
+
+    pos++;                                               /* Literal */
+    if (((pos - lit) == FLASH_DUMP_LIT_MAX) || (pos == lim)) {
+      o  += DumpLiteral(&out[o], lit, pos);              /* No literal run crosses a sector */
+      lit = pos;
+    }
+  }
+
+  o += DumpLiteral(&out[o], lit, pos);
+  ctl->outLen = o;
+
+  return (pos);
+}
+#endif /* FLASH_MEM && FLASH_EXT */
+
+
 #ifdef FLASH_OPT
 int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf)
 {
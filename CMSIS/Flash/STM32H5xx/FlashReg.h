@@ -0,0 +1,241 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2023 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.1.1
+ *
+ * Project:      Flash Register Definitions for ST STM32H5xx Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.1.1
+ *    Added ICACHE control registers for IAP cache maintenance
+ *  Version 1.1.0
+ *    Added SBS hide protection level and OPTSR SWAP_BANK, 32-bit types for host builds
+ *  Version 1.0.0
+ *    Initial release, register definitions moved from FlashPrg.c
+ */
+
+#ifndef FLASHREG_H_
+#define FLASHREG_H_
+
+typedef volatile unsigned int     vu32;   /* 32-bit on the target and on a 64-bit host */
+typedef          unsigned int      u32;
+
+#define M32(adr) (*((vu32 *) (adr)))
+
+// Peripheral Memory Map
+#ifndef FLASH_BASE
+#define FLASH_BASE       (0x40022000)      /* secure applications use 0x50022000 */
+#endif
+#ifndef SBS_BASE
+#define SBS_BASE         (0x44000400)      /* secure applications use 0x54000400 */
+#endif
+#ifndef ICACHE_BASE
+#define ICACHE_BASE      (0x40030400)      /* secure applications use 0x50030400 */
+#endif
+#define DBGMCU_BASE      (0xE0044000)
+#define FLASHSIZE_BASE   (0x08FFF80C)
+
+#define FLASH           ((FLASH_TypeDef  *) FLASH_BASE)
+#define SBS             ((SBS_TypeDef    *) SBS_BASE)
+#define ICACHE          ((ICACHE_TypeDef *) ICACHE_BASE)
+#define DBGMCU          ((DBGMCU_TypeDef *) DBGMCU_BASE)
+
+// Debug MCU
+typedef struct {
+  vu32 IDCODE;
+} DBGMCU_TypeDef;
+
+// System Configuration (SBS), hide protection level only
+typedef struct {
+  vu32 RESERVED0[4];    /*!< Reserved0,                                                         Address offset: 0x00-0x0C */
+  vu32 HDPLCR;          /*!< SBS temporal isolation control register,                           Address offset: 0x10 */
+  vu32 HDPLSR;          /*!< SBS temporal isolation status register,                            Address offset: 0x14 */
+} SBS_TypeDef;
+
+// Instruction Cache, control and status only
+typedef struct {
+  vu32 CR;              /*!< ICACHE control register,                                           Address offset: 0x00 */
+  vu32 SR;              /*!< ICACHE status register,                                            Address offset: 0x04 */
+} ICACHE_TypeDef;
+
+// Flash Registers
+typedef struct
+{
+  vu32 ACR;             /*!< FLASH access control register,                                     Address offset: 0x00 */
+  vu32 NSKEYR;          /*!< FLASH non-secure key register,                                     Address offset: 0x04 */
+  vu32 SECKEYR;         /*!< FLASH secure key register,                                         Address offset: 0x08 */
+  vu32 OPTKEYR;         /*!< FLASH option key register,                                         Address offset: 0x0C */
+  vu32 NSOBKKEYR;       /*!< FLASH non-secure option bytes keys key register,                   Address offset: 0x10 */
+  vu32 SECOBKKEYR;      /*!< FLASH secure option bytes keys key register,                       Address offset: 0x14 */
+  vu32 OPSR;            /*!< FLASH OPSR register,                                               Address offset: 0x18 */
+  vu32 OPTCR;           /*!< Flash Option Control Register,                                     Address offset: 0x1C */
+  vu32 NSSR;            /*!< FLASH non-secure status register,                                  Address offset: 0x20 */
+  vu32 SECSR;           /*!< FLASH secure status register,                                      Address offset: 0x24 */
+  vu32 NSCR;            /*!< FLASH non-secure control register,                                 Address offset: 0x28 */
+  vu32 SECCR;           /*!< FLASH secure control register,                                     Address offset: 0x2C */
+  vu32 NSCCR;           /*!< FLASH non-secure clear control register,                           Address offset: 0x30 */
+  vu32 SECCCR;          /*!< FLASH secure clear control register,                               Address offset: 0x34 */
+  vu32 RESERVED1;       /*!< Reserved1,                                                         Address offset: 0x38 */
+  vu32 PRIVCFGR;        /*!< FLASH privilege configuration register,                            Address offset: 0x3C */
+  vu32 NSOBKCFGR;       /*!< FLASH non-secure option byte key configuration register,           Address offset: 0x40 */
+  vu32 SECOBKCFGR;      /*!< FLASH secure option byte key configuration register,               Address offset: 0x44 */
+  vu32 HDPEXTR;         /*!< FLASH HDP extension register,                                      Address offset: 0x48 */
+  vu32 RESERVED2;       /*!< Reserved2,                                                         Address offset: 0x4C */
+  vu32 OPTSR_CUR;       /*!< FLASH option status current register,                              Address offset: 0x50 */
+  vu32 OPTSR_PRG;       /*!< FLASH option status to program register,                           Address offset: 0x54 */
+  vu32 RESERVED3[2];    /*!< Reserved3,                                                         Address offset: 0x58-0x5C */
+  vu32 NSEPOCHR_CUR;    /*!< FLASH non-secure epoch current register,                           Address offset: 0x60 */
+  vu32 NSEPOCHR_PRG;    /*!< FLASH non-secure epoch to program register,                        Address offset: 0x64 */
+  vu32 SECEPOCHR_CUR;   /*!< FLASH secure epoch current register,                               Address offset: 0x68 */
+  vu32 SECEPOCHR_PRG;   /*!< FLASH secure epoch to program register,                            Address offset: 0x6C */
+  vu32 OPTSR2_CUR;      /*!< FLASH option status current register 2,                            Address offset: 0x70 */
+  vu32 OPTSR2_PRG;      /*!< FLASH option status to program register 2,                         Address offset: 0x74 */
+  vu32 RESERVED4[2];    /*!< Reserved4,                                                         Address offset: 0x78-0x7C */
+  vu32 NSBOOTR_CUR;     /*!< FLASH non-secure unique boot entry current register,               Address offset: 0x80 */
+  vu32 NSBOOTR_PRG;     /*!< FLASH non-secure unique boot entry to program register,            Address offset: 0x84 */
+  vu32 SECBOOTR_CUR;    /*!< FLASH secure unique boot entry current register,                   Address offset: 0x88 */
+  vu32 SECBOOTR_PRG;    /*!< FLASH secure unique boot entry to program register,                Address offset: 0x8C */
+  vu32 OTPBLR_CUR;      /*!< FLASH OTP block lock current register,                             Address offset: 0x90 */
+  vu32 OTPBLR_PRG;      /*!< FLASH OTP block Lock to program register,                          Address offset: 0x94 */
+  vu32 WRP12R_CUR;      /*!< FLASH write sector group 1 protection for Bank2 current register    Address offset: 0x98 */
+  vu32 WRP12R_PRG;      /*!< FLASH write sector group 1 protection for Bank2 to program register Address offset: 0x9C */
+  vu32 SECBB1R1;        /*!< FLASH secure block-based bank 1 register 1,                        Address offset: 0xA0 */
+  vu32 SECBB1R2;        /*!< FLASH secure block-based bank 1 register 2,                        Address offset: 0xA4 */
+  vu32 SECBB1R3;        /*!< FLASH secure block-based bank 1 register 3,                        Address offset: 0xA8 */
+  vu32 SECBB1R4;        /*!< FLASH secure block-based bank 1 register 4,                        Address offset: 0xAC */
+  vu32 SECBB1R5;        /*!< FLASH secure block-based bank 1 register 5,                        Address offset: 0xB0 */
+  vu32 SECBB1R6;        /*!< FLASH secure block-based bank 1 register 6,                        Address offset: 0xB4 */
+  vu32 SECBB1R7;        /*!< FLASH secure block-based bank 1 register 7,                        Address offset: 0xB8 */
+  vu32 SECBB1R8;        /*!< FLASH secure block-based bank 1 register 8,                        Address offset: 0xBC */
+  vu32 PRIVBB1R1;       /*!< FLASH privilege block-based bank 1 register 1,                     Address offset: 0xC0 */
+  vu32 PRIVBB1R2;       /*!< FLASH privilege block-based bank 1 register 2,                     Address offset: 0xC4 */
+  vu32 PRIVBB1R3;       /*!< FLASH privilege block-based bank 1 register 3,                     Address offset: 0xC8 */
+  vu32 PRIVBB1R4;       /*!< FLASH privilege block-based bank 1 register 4,                     Address offset: 0xCC */
+  vu32 PRIVBB1R5;       /*!< FLASH privilege block-based bank 1 register 5,                     Address offset: 0xD0 */
+  vu32 PRIVBB1R6;       /*!< FLASH privilege block-based bank 1 register 6,                     Address offset: 0xD4 */
+  vu32 PRIVBB1R7;       /*!< FLASH privilege block-based bank 1 register 7,                     Address offset: 0xD8 */
+  vu32 PRIVBB1R8;       /*!< FLASH privilege block-based bank 1 register 8,                     Address offset: 0xDC */
+  vu32 SECWM1R_CUR;     /*!< FLASH secure watermark 1 current register,                         Address offset: 0xE0 */
+  vu32 SECWM1R_PRG;     /*!< FLASH secure watermark 1 to program register,                      Address offset: 0xE4 */
+  vu32 WRP11R_CUR;      /*!< FLASH write sector group protection current register for bank1,    Address offset: 0xE8 */
+  vu32 WRP11R_PRG;      /*!< FLASH write sector group protection to program register for bank1, Address offset: 0xEC */
+  vu32 EDATA1R_CUR;     /*!< FLASH data sectors configuration current register for bank1,       Address offset: 0xF0 */
+  vu32 EDATA1R_PRG;     /*!< FLASH data sectors configuration to program register for bank1,    Address offset: 0xF4 */
+  vu32 HDP1R_CUR;       /*!< FLASH HDP configuration current register for bank1,                Address offset: 0xF8 */
+  vu32 HDP1R_PRG;       /*!< FLASH HDP configuration to program register for bank1,             Address offset: 0xFC */
+  vu32 ECCCORR;         /*!< FLASH ECC correction register,                                     Address offset: 0x100 */
+  vu32 ECCDETR;         /*!< FLASH ECC detection register,                                      Address offset: 0x104 */
+  vu32 ECCDR;           /*!< FLASH ECC data register,                                           Address offset: 0x108 */
+  vu32 RESERVED8[35];   /*!< Reserved8,                                                         Address offset: 0x10C-0x194 */
+  vu32 WRP22R_CUR;      /*!< FLASH write sector group 2 protection for Bank2 current register    Address offset: 0x198 */
+  vu32 WRP22R_PRG;      /*!< FLASH write sector group 2 protection for Bank2 to program register Address offset: 0x19C */
+  vu32 SECBB2R1;        /*!< FLASH secure block-based bank 2 register 1,                        Address offset: 0x1A0 */
+  vu32 SECBB2R2;        /*!< FLASH secure block-based bank 2 register 2,                        Address offset: 0x1A4 */
+  vu32 SECBB2R3;        /*!< FLASH secure block-based bank 2 register 3,                        Address offset: 0x1A8 */
+  vu32 SECBB2R4;        /*!< FLASH secure block-based bank 2 register 4,                        Address offset: 0x1AC */
+  vu32 SECBB2R5;        /*!< FLASH secure block-based bank 2 register 5,                        Address offset: 0x1B0 */
+  vu32 SECBB2R6;        /*!< FLASH secure block-based bank 2 register 6,                        Address offset: 0x1B4 */
+  vu32 SECBB2R7;        /*!< FLASH secure block-based bank 2 register 7,                        Address offset: 0x1B8 */
+  vu32 SECBB2R8;        /*!< FLASH secure block-based bank 2 register 8,                        Address offset: 0x1BC */
+  vu32 PRIVBB2R1;       /*!< FLASH privilege block-based bank 2 register 1,                     Address offset: 0x1C0 */
+  vu32 PRIVBB2R2;       /*!< FLASH privilege block-based bank 2 register 2,                     Address offset: 0x1C4 */
+  vu32 PRIVBB2R3;       /*!< FLASH privilege block-based bank 2 register 3,                     Address offset: 0x1C8 */
+  vu32 PRIVBB2R4;       /*!< FLASH privilege block-based bank 2 register 4,                     Address offset: 0x1CC */
+  vu32 PRIVBB2R5;       /*!< FLASH privilege block-based bank 2 register 5,                     Address offset: 0x1D0 */
+  vu32 PRIVBB2R6;       /*!< FLASH privilege block-based bank 2 register 6,                     Address offset: 0x1D4 */
+  vu32 PRIVBB2R7;       /*!< FLASH privilege block-based bank 2 register 7,                     Address offset: 0x1D8 */
+  vu32 PRIVBB2R8;       /*!< FLASH privilege block-based bank 2 register 8,                     Address offset: 0x1DC */
+  vu32 SECWM2R_CUR;     /*!< FLASH secure watermark 2 current register,                         Address offset: 0x1E0 */
+  vu32 SECWM2R_PRG;     /*!< FLASH secure watermark 2 to program register,                      Address offset: 0x1E4 */
+  vu32 WRP21R_CUR;       /*!< FLASH write sector group protection current register for bank2,    Address offset: 0x1E8 */
+  vu32 WRP21R_PRG;       /*!< FLASH write sector group protection to program register for bank2, Address offset: 0x1EC */
+  vu32 EDATA2R_CUR;     /*!< FLASH data sectors configuration current register for bank2,       Address offset: 0x1F0 */
+  vu32 EDATA2R_PRG;     /*!< FLASH data sectors configuration to program register for bank2,    Address offset: 0x1F4 */
+  vu32 HDP2R_CUR;       /*!< FLASH HDP configuration current register for bank2,                Address offset: 0x1F8 */
+  vu32 HDP2R_PRG;       /*!< FLASH HDP configuration to program register for bank2,             Address offset: 0x1FC */
+} FLASH_TypeDef;
+// Flash Keys
+#define FLASH_KEY1               0x45670123
+#define FLASH_KEY2               0xCDEF89AB
+#define FLASH_OPTKEY1            0x08192A3B
+#define FLASH_OPTKEY2            0x4C5D6E7F
+
+// Flash Control Register definitions
+#define FLASH_CR_LOCK           ((u32)(  1U      ))
+#define FLASH_CR_PG             ((u32)(  1U <<  1))
+#define FLASH_CR_SER            ((u32)(  1U <<  2))
+#define FLASH_CR_BER            ((u32)(  1U <<  3))
+#define FLASH_CR_FW             ((u32)(  1U <<  4))
+#define FLASH_CR_STRT           ((u32)(  1U <<  5))
+#define FLASH_CR_PNB_MSK        ((u32)(0x7F <<  6))
+#define FLASH_CR_MER            ((u32)(  1U << 15))
+#define FLASH_CR_EOPIE          ((u32)(  1U << 16))
+#define FLASH_CR_ERRIE          ((u32)(0x3F << 17))      /* WRPERRIE .. OBKWERRIE */
+#define FLASH_CR_BKSEL          ((u32)(  1U << 31))
+
+
+// Flash Status Register definitions
+#define FLASH_SR_BSY            ((u32)(  1U      ))
+#define FLASH_SR_WBNE           ((u32)(  1U <<  1))
+#define FLASH_SR_DBNE           ((u32)(  1U <<  3))
+#define FLASH_SR_EOP            ((u32)(  1U << 16))
+#define FLASH_SR_WRPERR         ((u32)(  1U << 17))
+#define FLASH_SR_PGSERR         ((u32)(  1U << 18))
+#define FLASH_SR_STRBERR        ((u32)(  1U << 19))
+#define FLASH_SR_INCERR         ((u32)(  1U << 20))
+#define FLASH_SR_OBKERR         ((u32)(  1U << 21))
+#define FLASH_SR_OBKWERR        ((u32)(  1U << 22))
+#define FLASH_SR_OPTCHANGEERR   ((u32)(  1U << 23))
+
+// Flash option register definitions
+#define FLASH_OPTR_RDP          ((u32)(0xFF      ))
+#define FLASH_OPTR_RDP_NO       ((u32)(0xAA      ))
+#define FLASH_OPTR_TZEN         ((u32)(0xFF000000))
+#define FLASH_OPTSR_SWAP_BANK   ((u32)(  1U << 31))      /* OPTSR_CUR: bank 2 mapped at the flash base */
+
+// Flash protection register definitions
+#define FLASH_AREA_STRT_MSK     ((u32)(0xFF      ))      /* HDPxR, SECWMxR start sector */
+#define FLASH_AREA_END_POS      (16U)                    /* HDPxR, SECWMxR end sector */
+#define FLASH_AREA_END_MSK      ((u32)(0xFF << 16))
+#define FLASH_HDPEXT_MSK        ((u32)(0xFF      ))      /* HDPEXTR: HDP1_EXT, HDP2_EXT (<< 16) */
+#define FLASH_EDATA_EN          ((u32)(  1U << 15))
+#define FLASH_EDATA_STRT_MSK    ((u32)(0x07      ))
+
+// SBS hide protection level (HDPLSR)
+#define SBS_HDPL_MSK            ((u32)(0xFF      ))
+#define SBS_HDPL_0              ((u32)(0xB4      ))      /* HDPL0: boot ROM */
+#define SBS_HDPL_1              ((u32)(0x51      ))      /* HDPL1: HDP area accessible */
+#define SBS_HDPL_2              ((u32)(0x8A      ))      /* HDPL2: HDP area hidden */
+#define SBS_HDPL_3              ((u32)(0x6F      ))      /* HDPL3: HDP area and extension hidden */
+
+// ICACHE register definitions
+#define ICACHE_CR_EN            ((u32)(  1U      ))
+#define ICACHE_CR_CACHEINV      ((u32)(  1U <<  1))      /* invalidate the whole cache, no range maintenance */
+#define ICACHE_SR_BUSYF         ((u32)(  1U      ))
+
+#define FLASH_PGERR             (FLASH_SR_WRPERR | FLASH_SR_STRBERR | FLASH_SR_PGSERR | \
+                                 FLASH_SR_INCERR | FLASH_SR_OBKERR  | FLASH_SR_OBKWERR)
+
+#define FLASH_SECTOR_SHIFT      (13U)                    /* 8K sector size */
+#define FLASH_SECTOR_MAX        (512U)                   /* 4M / 8K sectors */
+
+#endif /* FLASHREG_H_ */
@@ -0,0 +1,80 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2023 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Flash Streaming Interface for ST STM32H5xx Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/* Note:
+   ProgramStream(adr, sz, ring) programs sz bytes from a ring buffer in
+   SRAM while the core runs. The host (debugger) writes the ring through
+   memory access and is the only writer of 'wr' and 'cmd', the algorithm
+   is the only writer of 'rd', 'state' and 'errAdr':
+     1. host initializes the control block: wr = rd = 0, state = IDLE,
+        size = data area size (power of 2, multiple of 16); a call
+        with rd not a multiple of 16 fails with state ERROR
+     2. host starts ProgramStream and does not wait for the breakpoint
+     3. host copies data to data[wr & (size - 1)], then advances wr;
+        free space is size - (wr - rd)
+     4. algorithm programs each complete quad-word and advances rd
+     5. ProgramStream returns and halts when sz bytes are programmed,
+        state is DONE or ERROR (errAdr = failed address)
+   The last quad-word is padded by the host. Writing cmd = ABORT ends the
+   stream early. Indices run free and wrap at 2^32.
+   The debugger applies the toProg timeout of the FlashDevice to the whole
+   call, as for ProgramPage: the host splits larger ranges into several
+   ProgramStream calls and refills the ring in large steps, every poll of
+   'rd' costs one probe round trip.
+   Types are 32-bit on the target and on a 32/64-bit host. */
+
+#ifndef FLASHSTREAM_H_
+#define FLASHSTREAM_H_
+
+#define FLASH_STREAM_IDLE       (0U)       /* not started */
+#define FLASH_STREAM_RUN        (1U)       /* waiting for data or programming */
+#define FLASH_STREAM_DONE       (2U)       /* all data programmed */
+#define FLASH_STREAM_ERROR      (3U)       /* protection or programming error */
+#define FLASH_STREAM_ABORTED    (4U)       /* ended by FLASH_STREAM_ABORT */
+
+#define FLASH_STREAM_ABORT      (1U)       /* cmd: end stream */
+
+#define FLASH_STREAM_ALIGN      (16U)      /* data granularity (quad-word) */
+
+typedef struct {
+  volatile unsigned int wr;                /* Producer index in bytes (host) */
+  volatile unsigned int rd;                /* Consumer index in bytes (target) */
+  volatile unsigned int cmd;               /* Command (host) */
+  volatile unsigned int state;             /* FLASH_STREAM_xxx (target) */
+  volatile unsigned int errAdr;            /* Failed address (target) */
+           unsigned int size;              /* Size of data area in bytes */
+           unsigned int reserved[2];
+} FlashStream_t;
+
+/* Data area follows the control block */
+#define FLASH_STREAM_DATA(s)    ((unsigned char *)(s) + sizeof(FlashStream_t))
+
+#endif /* FLASHSTREAM_H_ */
@@ -0,0 +1,349 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2023 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.1
+ *
+ * Project:      In-Application Programming for ST STM32H5xx Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.1
+ *    ICACHE invalidated before the completion callback, bank number
+ *    follows SWAP_BANK, no flash resident calls from RAM functions,
+ *    host test build (FLASH_HOST)
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/* Note:
+   Requests are queued and executed interrupt driven: the flash
+   controller signals the end of each sector erase and quad-word
+   program (EOP), the interrupt handler starts the next step.
+   The CPU only stalls when it reads the bank that is being written,
+   code running from the other bank continues (read-while-write).
+   Functions used while a bank is busy are placed in RAM (.RamFunc)
+   and call only RAM functions and inline code.
+   The instruction cache holds no range maintenance, it is invalidated
+   completely when a request completes, before its callback.
+   FLASH_HOST builds the functions for host tests (Utilities/Flash/FlashIAPTest.c),
+   which provide DSB(), IrqLock() and IrqUnlock(). */
+
+#include "FlashIAP.h"
+
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+#define FLASH_BASE       (0x50022000)                    /* Secure alias of Flash registers */
+#define ICACHE_BASE      (0x50030400)                    /* Secure alias of ICACHE registers */
+#define FLASH_MEM_BASE   (0x0C000000)                    /* Secure alias of Flash memory */
+#else
+#define FLASH_MEM_BASE   (0x08000000)
+#endif
+
+#include "../FlashReg.h"         /* Flash Register Definitions */
+
+#ifndef FLASH_IAP_RAMFUNC
+#if defined(__ICCARM__)
+#define FLASH_IAP_RAMFUNC        __ramfunc
+#else
+#define FLASH_IAP_RAMFUNC        __attribute__((section(".RamFunc"), noinline))
+#endif
+#endif
+
+#define QW_SIZE                  (16U)                   /* Programming granularity (quad-word) */
+
+#define OP_ERASE                 (1U)
+#define OP_PROGRAM               (2U)
+
+typedef struct {
+  uint32_t             op;                               /* OP_ERASE, OP_PROGRAM */
+  uint32_t             adr;
+  const uint8_t       *buf;
+  uint32_t             size;
+  FlashIAP_Callback_t  cb;
+  void                *arg;
+} Request_t;
+
+static Request_t         Queue[FLASH_IAP_QUEUE_SIZE];
+static volatile uint32_t QueueHead;                      /* Active request (free running index) */
+static volatile uint32_t QueueTail;                      /* Next free entry (free running index) */
+static volatile uint32_t ProgOfs;                        /* Programmed bytes of active request */
+
+static u32 gFlashBase;                   /* Flash base address */
+static u32 gFlashSize;                   /* Flash size in bytes */
+static u32 gFlashSwap;                   /* 1: SWAP_BANK, bank 2 at the Flash base */
+
+static vu32 *pFlashCR;                   /* Pointer to Flash Control register */
+static vu32 *pFlashSR;                   /* Pointer to Flash Status register */
+static vu32 *pFlashCCR;                  /* Pointer to Flash Clear Control register */
+
+
+#if !defined FLASH_HOST
+#define DSB()   __asm volatile ("dsb" : : : "memory")    /* inline: usable in RAM functions */
+
+static uint32_t IrqLock (void) {
+  uint32_t primask;
+
+  __asm volatile ("mrs %0, primask" : "=r" (primask) : : "memory");
+  __asm volatile ("cpsid i" : : : "memory");
+  return (primask);
+}
+
+static void IrqUnlock (uint32_t primask) {
+  __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+#endif /* FLASH_HOST */
+
+
+/*
+ * Get Flash Bank Number
+ *    Parameter:      adr:  Sector Address
+ *    Return Value:   Bank Number (0..1)
+ *                    Flash bank size is always the half of the Flash size,
+ *                    with SWAP_BANK set bank 2 is mapped at the Flash base
+ */
+
+FLASH_IAP_RAMFUNC
+static u32 GetFlashBankNum (u32 adr) {
+  return (((adr >= (gFlashBase + (gFlashSize >> 1))) ? 1U : 0U) ^ gFlashSwap);
+}
+
+
+/*
+ * Write one quad-word, programming starts when the write buffer is full
+ */
+
+FLASH_IAP_RAMFUNC
+static void WriteQuadWord (u32 adr, const uint8_t *buf) {
+  u32 i;
+
+  for (i = 0U; i < QW_SIZE; i += 4U) {
+    M32(adr + i) = (u32)((buf[i    ]      ) |
+                         (buf[i + 1] <<  8) |
+                         (buf[i + 2] << 16) |
+                         (buf[i + 3] << 24) );
+  }
+  DSB();
+}
+
+
+/*
+ * Start request at queue head (queue must be locked or called from IRQ)
+ */
+
+FLASH_IAP_RAMFUNC
+static void StartRequest (void) {
+  const Request_t *r;
+  u32 b, p;
+
+  if (QueueHead == QueueTail) {
+    return;                                              /* Idle */
+  }
+  r       = &Queue[QueueHead % FLASH_IAP_QUEUE_SIZE];
+  ProgOfs = 0U;
+
+  *pFlashCCR = FLASH_PGERR | FLASH_SR_EOP;               /* Reset Flags */
+
+  if (r->op == OP_ERASE) {
+    b = GetFlashBankNum(r->adr);
+    p = ((r->adr - gFlashBase) & ((gFlashSize >> 1) - 1U)) >> FLASH_SECTOR_SHIFT;
+    *pFlashCR  = (FLASH_CR_SER   |                       /* Sector Erase Enabled */
+                  (p <<  6)      |                       /* Sector Number */
+                  (b << 31)      |                       /* Bank Number */
+                  FLASH_CR_EOPIE | FLASH_CR_ERRIE);
+    *pFlashCR |= FLASH_CR_STRT;                          /* Start Erase */
+    DSB();
+  } else {
+    *pFlashCR  = FLASH_CR_PG | FLASH_CR_EOPIE | FLASH_CR_ERRIE;
+    WriteQuadWord(r->adr, r->buf);                       /* First quad-word, rest from IRQ */
+  }
+}
+
+
+/*
+ * Queue request, starts it when the controller is idle
+ */
+
+static int32_t Enqueue (u32 op, u32 adr, const void *buf, u32 size, FlashIAP_Callback_t cb, void *arg) {
+  Request_t *r;
+  uint32_t   primask;
+
+  if (pFlashCR == 0) {
+    return (FLASH_IAP_ERROR);
+  }
+
+  primask = IrqLock();
+  if ((QueueTail - QueueHead) >= FLASH_IAP_QUEUE_SIZE) {
+    IrqUnlock(primask);
+    return (FLASH_IAP_ERROR_BUSY);
+  }
+  r       = &Queue[QueueTail % FLASH_IAP_QUEUE_SIZE];
+  r->op   = op;
+  r->adr  = adr;
+  r->buf  = (const uint8_t *)buf;
+  r->size = size;
+  r->cb   = cb;
+  r->arg  = arg;
+  QueueTail++;
+  if ((QueueTail - QueueHead) == 1U) {
+    StartRequest();                                      /* Controller was idle */
+  }
+  IrqUnlock(primask);
+
+  return (FLASH_IAP_OK);
+}
+
+
+int32_t FlashIAP_Initialize (void) {
+
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  pFlashCR  = &FLASH->SECCR;
+  pFlashSR  = &FLASH->SECSR;
+  pFlashCCR = &FLASH->SECCCR;
+  if ((*pFlashCR & FLASH_CR_LOCK) != 0U) {
+    FLASH->SECKEYR = FLASH_KEY1;                         /* unlock FLASH_SECCR */
+    FLASH->SECKEYR = FLASH_KEY2;
+  }
+#else
+  pFlashCR  = &FLASH->NSCR;
+  pFlashSR  = &FLASH->NSSR;
+  pFlashCCR = &FLASH->NSCCR;
+  if ((*pFlashCR & FLASH_CR_LOCK) != 0U) {
+    FLASH->NSKEYR = FLASH_KEY1;                          /* unlock FLASH_NSCR */
+    FLASH->NSKEYR = FLASH_KEY2;
+  }
+#endif
+  DSB();
+  if ((*pFlashCR & FLASH_CR_LOCK) != 0U) {
+    pFlashCR = 0;
+    return (FLASH_IAP_ERROR);                            /* Locked until next reset */
+  }
+
+  while (*pFlashSR & FLASH_SR_BSY);                      /* Wait until operation is finished */
+
+  gFlashBase = FLASH_MEM_BASE;
+  gFlashSize = (M32(FLASHSIZE_BASE) & 0x0000FFFF) << 10;
+  gFlashSwap = ((FLASH->OPTSR_CUR & FLASH_OPTSR_SWAP_BANK) != 0U) ? 1U : 0U;
+
+  QueueHead = 0U;
+  QueueTail = 0U;
+  *pFlashCCR = FLASH_PGERR | FLASH_SR_EOP;               /* Reset Flags */
+  *pFlashCR  = 0U;
+
+  return (FLASH_IAP_OK);
+}
+
+
+int32_t FlashIAP_Uninitialize (void) {
+  uint32_t primask;
+
+  if (pFlashCR == 0) {
+    return (FLASH_IAP_OK);
+  }
+  while (*pFlashSR & FLASH_SR_BSY);                      /* Active step can not be aborted */
+
+  primask = IrqLock();
+  QueueHead = QueueTail;                                 /* Discard pending requests */
+  *pFlashCR = FLASH_CR_LOCK;                             /* Lock Flash, disable interrupts */
+  pFlashCR  = 0;
+  IrqUnlock(primask);
+
+  return (FLASH_IAP_OK);
+}
+
+
+int32_t FlashIAP_EraseSector (uint32_t adr, FlashIAP_Callback_t cb, void *arg) {
+  if ((adr < gFlashBase) || (adr >= (gFlashBase + gFlashSize))) {
+    return (FLASH_IAP_ERROR_PARAMETER);
+  }
+  return (Enqueue(OP_ERASE, adr & ~((1U << FLASH_SECTOR_SHIFT) - 1U), 0, 0U, cb, arg));
+}
+
+
+int32_t FlashIAP_Program (uint32_t adr, const void *buf, uint32_t size, FlashIAP_Callback_t cb, void *arg) {
+  if ((buf == 0) || (size == 0U) || ((adr & (QW_SIZE - 1U)) != 0U) || ((size & (QW_SIZE - 1U)) != 0U) ||
+      (adr < gFlashBase) || (size > gFlashSize) || ((adr - gFlashBase) > (gFlashSize - size))) {
+    return (FLASH_IAP_ERROR_PARAMETER);
+  }
+  return (Enqueue(OP_PROGRAM, adr, buf, size, cb, arg));
+}
+
+
+uint32_t FlashIAP_Pending (void) {
+  return (QueueTail - QueueHead);
+}
+
+
+int32_t FlashIAP_ActiveBank (void) {
+  uint32_t head = QueueHead;
+
+  if (head == QueueTail) {
+    return (-1);
+  }
+  return ((int32_t)GetFlashBankNum(Queue[head % FLASH_IAP_QUEUE_SIZE].adr));
+}
+
+
+FLASH_IAP_RAMFUNC
+void FlashIAP_IRQHandler (void) {
+  const Request_t    *r;
+  FlashIAP_Callback_t cb;
+  void               *arg;
+  u32                 sr, adr, event;
+
+  if (pFlashCR == 0) {
+    return;
+  }
+  sr = *pFlashSR & (FLASH_SR_EOP | FLASH_PGERR);
+  if (sr == 0U) {
+    return;
+  }
+  *pFlashCCR = sr;                                       /* Reset Flags */
+
+  if (QueueHead == QueueTail) {
+    return;                                              /* No active request */
+  }
+  r = &Queue[QueueHead % FLASH_IAP_QUEUE_SIZE];
+
+  if (((sr & FLASH_PGERR) == 0U) && (r->op == OP_PROGRAM)) {
+    ProgOfs += QW_SIZE;
+    if (ProgOfs < r->size) {
+      WriteQuadWord(r->adr + ProgOfs, &r->buf[ProgOfs]); /* Next quad-word */
+      return;
+    }
+  }
+
+  event = ((sr & FLASH_PGERR) != 0U) ? FLASH_IAP_EVENT_ERROR : FLASH_IAP_EVENT_DONE;
+  cb    = r->cb;
+  adr   = r->adr;
+  arg   = r->arg;
+
+  *pFlashCR = 0U;                                        /* Reset CR */
+  QueueHead++;
+  StartRequest();                                        /* Keep the controller busy */
+
+  if ((ICACHE->CR & ICACHE_CR_EN) != 0U) {               /* Drop stale lines of the changed range */
+    ICACHE->CR |= ICACHE_CR_CACHEINV;
+    while ((ICACHE->SR & ICACHE_SR_BUSYF) != 0U);
+  }
+
+  if (cb != 0) {
+    cb(event, adr, arg);
+  }
+}
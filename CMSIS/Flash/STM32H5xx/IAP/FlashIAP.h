@@ -0,0 +1,87 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2023 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.1
+ *
+ * Project:      In-Application Programming for ST STM32H5xx Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.1
+ *    FlashIAP_ActiveBank returns the physical bank
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+#ifndef FLASHIAP_H_
+#define FLASHIAP_H_
+
+#include <stdint.h>
+
+// Return codes
+#define FLASH_IAP_OK                (0)     /* Operation succeeded / queued */
+#define FLASH_IAP_ERROR             (-1)    /* Unspecified error */
+#define FLASH_IAP_ERROR_BUSY        (-2)    /* Request queue full */
+#define FLASH_IAP_ERROR_PARAMETER   (-5)    /* Address/size not aligned or outside flash */
+
+// Completion events (callback)
+#define FLASH_IAP_EVENT_DONE        (1U)    /* Request completed */
+#define FLASH_IAP_EVENT_ERROR       (2U)    /* Request failed (protection, programming error) */
+
+#ifndef FLASH_IAP_QUEUE_SIZE
+#define FLASH_IAP_QUEUE_SIZE        (8U)    /* Number of pending requests */
+#endif
+
+/* Completion callback, called from FlashIAP_IRQHandler (interrupt context)
+   after the instruction cache is invalidated
+     event: FLASH_IAP_EVENT_xxx
+     adr:   start address of the request
+     arg:   user argument of the request */
+typedef void (*FlashIAP_Callback_t) (uint32_t event, uint32_t adr, void *arg);
+
+/* Unlock flash, enable end-of-operation and error interrupts.
+   Enable FLASH_IRQn (FLASH_S_IRQn in secure applications) in NVIC
+   and call FlashIAP_IRQHandler from FLASH_IRQHandler. */
+extern int32_t  FlashIAP_Initialize   (void);
+
+/* Lock flash, pending requests are discarded */
+extern int32_t  FlashIAP_Uninitialize (void);
+
+/* Queue erase of the 8K sector containing adr */
+extern int32_t  FlashIAP_EraseSector  (uint32_t adr, FlashIAP_Callback_t cb, void *arg);
+
+/* Queue programming of size bytes (multiple of 16) to adr (16-byte aligned).
+   buf must stay valid until the callback is called. */
+extern int32_t  FlashIAP_Program      (uint32_t adr, const void *buf, uint32_t size, FlashIAP_Callback_t cb, void *arg);
+
+/* Number of queued requests including the active one */
+extern uint32_t FlashIAP_Pending      (void);
+
+/* Bank (0..1) with an active operation, -1 if idle. The bank number is
+   physical (0: bank 1, 1: bank 2), with SWAP_BANK set bank 2 is mapped
+   at the Flash base.
+   Code and data of the other bank can be read without stall (read-while-write). */
+extern int32_t  FlashIAP_ActiveBank   (void);
+
+/* Flash interrupt handler */
+extern void     FlashIAP_IRQHandler   (void);
+
+#endif /* FLASHIAP_H_ */
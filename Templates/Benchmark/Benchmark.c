@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Cycle counting benchmark harness
+ *
+ * Target: call Benchmark_Run() from main() after the CubeMX system
+ * initialization. Cycles are measured with DWT CYCCNT, results are
+ * written to ITM stimulus port 0 (enable SWO trace in the debugger).
+ * Build type 'Performance' defines BENCH_CACHE_ENABLE which enables
+ * ICACHE and the flash prefetch buffer before the kernels run.
+ *
+ * Host:   the same kernels build natively for sanity checks of the
+ * checksums, the time base is nanoseconds instead of cycles:
+ *   cc -O2 -DBENCH_HOST -o Benchmark Benchmark.c Kernels.c && ./Benchmark
+ */
+
+#include <stdio.h>
+#include "Benchmark.h"
+#include "Kernels.h"
+
+#ifdef BENCH_HOST
+
+#include <time.h>
+
+#define BENCH_UNIT      "ns"
+
+static void Bench_Init (void) {
+}
+
+static uint32_t Bench_Time (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint32_t)(((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec));
+}
+
+static void Bench_Print (const char *str) {
+  fputs(str, stdout);
+}
+
+#else
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#define BENCH_UNIT      "cycles"
+
+static void Bench_Init (void) {
+#ifdef BENCH_CACHE_ENABLE
+  FLASH->ACR |= FLASH_ACR_PRFTEN;                       /* Flash prefetch buffer */
+  if ((ICACHE->CR & ICACHE_CR_EN) == 0U) {
+    ICACHE->CR |= ICACHE_CR_EN;                         /* Instruction cache */
+  }
+#endif
+
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;                   /* Enable DWT */
+  DWT->CYCCNT = 0U;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;                 /* Start cycle counter */
+}
+
+static uint32_t Bench_Time (void) {
+  return (DWT->CYCCNT);
+}
+
+static void Bench_Print (const char *str) {
+  while (*str != '\0') {
+    (void)ITM_SendChar((uint32_t)*str++);
+  }
+}
+
+#endif /* BENCH_HOST */
+
+void Benchmark_Run (void) {
+  char     line[96];
+  uint32_t i, n;
+  uint32_t t0, t, tmin;
+  uint32_t sum = 0U;
+
+  Bench_Init();
+  Kernels_Init();
+
+  (void)snprintf(line, sizeof(line), "%-12s %10s %8s %10s %10s\n",
+                 "kernel", BENCH_UNIT, "bytes", "x100/byte", "checksum");
+  Bench_Print(line);
+
+  for (i = 0U; i < KernelCount; i++) {
+    tmin = 0xFFFFFFFFU;
+    for (n = 0U; n < BENCH_REPEAT; n++) {               /* First run warms up caches */
+      t0  = Bench_Time();
+      sum = Kernels[i].run();
+      t   = Bench_Time() - t0;
+      if (t < tmin) {
+        tmin = t;
+      }
+    }
+    if (Kernels[i].check != NULL) {
+      sum = Kernels[i].check();                         /* Outside the timed region */
+    }
+    (void)snprintf(line, sizeof(line), "%-12s %10u %8u %10u 0x%08X\n",
+                   Kernels[i].name,
+                   (unsigned int)tmin,
+                   (unsigned int)Kernels[i].bytes,
+                   (unsigned int)(((uint64_t)tmin * 100U) / Kernels[i].bytes),
+                   (unsigned int)sum);
+    Bench_Print(line);
+  }
+}
+
+#ifdef BENCH_HOST
+int main (void) {
+  Benchmark_Run();
+  return (0);
+}
+#endif
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include "Kernels.h"
+
+#define BUF_SIZE        4096U           /* memcpy/CRC buffer size in bytes */
+#define FIR_TAPS        32U
+#define FIR_SAMPLES     512U
+#define DOT_SIZE        1024U
+#define MAT_DIM         16U
+
+static uint32_t SrcBuf[BUF_SIZE / 4U];
+static uint32_t DstBuf[BUF_SIZE / 4U];
+static uint32_t CrcTable[256];
+
+static float    FirCoeff[FIR_TAPS];
+static float    FirIn   [FIR_SAMPLES + FIR_TAPS - 1U];
+static float    FirOut  [FIR_SAMPLES];
+
+static int16_t  DotA[DOT_SIZE];
+static int16_t  DotB[DOT_SIZE];
+
+static float    MatA[MAT_DIM * MAT_DIM];
+static float    MatB[MAT_DIM * MAT_DIM];
+static float    MatC[MAT_DIM * MAT_DIM];
+
+/* Deterministic pseudo random sequence (xorshift32) */
+static uint32_t Rand (uint32_t *state) {
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return (x);
+}
+
+/* Checksum of a word buffer, makes results comparable between toolchains */
+static uint32_t Checksum (const uint32_t *buf, uint32_t words) {
+  uint32_t sum = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < words; i++) {
+    sum = (sum << 1) ^ (sum >> 31) ^ buf[i];
+  }
+  return (sum);
+}
+
+/* Bit pattern of a float, avoids compiler specific type punning */
+static uint32_t FloatBits (float f) {
+  uint32_t u;
+
+  memcpy(&u, &f, sizeof(u));
+  return (u);
+}
+
+void Kernels_Init (void) {
+  uint32_t seed = 0x12345678U;
+  uint32_t i, c, k;
+
+  for (i = 0U; i < (BUF_SIZE / 4U); i++) {
+    SrcBuf[i] = Rand(&seed);
+  }
+
+  for (i = 0U; i < 256U; i++) {         /* CRC-32 (IEEE 802.3, reflected) */
+    c = i;
+    for (k = 0U; k < 8U; k++) {
+      c = (c & 1U) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+    }
+    CrcTable[i] = c;
+  }
+
+  for (i = 0U; i < FIR_TAPS; i++) {
+    FirCoeff[i] = (float)((int32_t)(Rand(&seed) & 0xFFFFU) - 0x8000) / 32768.0f / (float)FIR_TAPS;
+  }
+  for (i = 0U; i < (FIR_SAMPLES + FIR_TAPS - 1U); i++) {
+    FirIn[i] = (float)((int32_t)(Rand(&seed) & 0xFFFFU) - 0x8000) / 32768.0f;
+  }
+
+  for (i = 0U; i < DOT_SIZE; i++) {
+    DotA[i] = (int16_t)(Rand(&seed) >> 16);
+    DotB[i] = (int16_t)(Rand(&seed) >> 16);
+  }
+
+  for (i = 0U; i < (MAT_DIM * MAT_DIM); i++) {
+    MatA[i] = (float)(Rand(&seed) & 0xFFU) / 256.0f;
+    MatB[i] = (float)(Rand(&seed) & 0xFFU) / 256.0f;
+  }
+}
+
+/* Checksum of the copy destination, not part of the timed copy kernels */
+static uint32_t Check_DstBuf (void) {
+  return (Checksum(DstBuf, BUF_SIZE / 4U));
+}
+
+/* C library memcpy */
+static uint32_t Kernel_Memcpy (void) {
+  memcpy(DstBuf, SrcBuf, BUF_SIZE);
+  return (DstBuf[(BUF_SIZE / 4U) - 1U]);
+}
+
+/* Word copy loop, unrolled by 4 */
+static uint32_t Kernel_CopyWords (void) {
+  const uint32_t *s = SrcBuf;
+  uint32_t       *d = DstBuf;
+  uint32_t        n = BUF_SIZE / 16U;
+
+  while (n--) {
+    d[0] = s[0];
+    d[1] = s[1];
+    d[2] = s[2];
+    d[3] = s[3];
+    d += 4;
+    s += 4;
+  }
+  return (DstBuf[(BUF_SIZE / 4U) - 1U]);
+}
+
+/* Table driven CRC-32 */
+static uint32_t Kernel_Crc32 (void) {
+  const uint8_t *p   = (const uint8_t *)SrcBuf;
+  uint32_t       crc = 0xFFFFFFFFU;
+  uint32_t       n;
+
+  for (n = 0U; n < BUF_SIZE; n++) {
+    crc = CrcTable[(crc ^ p[n]) & 0xFFU] ^ (crc >> 8);
+  }
+  return (crc ^ 0xFFFFFFFFU);
+}
+
+/* FIR filter, single precision FPU */
+static uint32_t Kernel_FirF32 (void) {
+  uint32_t n, k;
+  float    acc;
+
+  for (n = 0U; n < FIR_SAMPLES; n++) {
+    acc = 0.0f;
+    for (k = 0U; k < FIR_TAPS; k++) {
+      acc += FirCoeff[k] * FirIn[n + k];
+    }
+    FirOut[n] = acc;
+  }
+  return (FloatBits(FirOut[0]) ^ FloatBits(FirOut[FIR_SAMPLES - 1U]));
+}
+
+/* Q15 dot product with 64-bit accumulator (DSP MAC) */
+static uint32_t Kernel_DotQ15 (void) {
+  int64_t  acc = 0;
+  uint32_t i;
+
+  for (i = 0U; i < DOT_SIZE; i++) {
+    acc += (int32_t)DotA[i] * (int32_t)DotB[i];
+  }
+  return ((uint32_t)acc ^ (uint32_t)((uint64_t)acc >> 32));
+}
+
+/* Square matrix multiplication, single precision FPU */
+static uint32_t Kernel_MatMulF32 (void) {
+  uint32_t r, c, k;
+  float    acc;
+
+  for (r = 0U; r < MAT_DIM; r++) {
+    for (c = 0U; c < MAT_DIM; c++) {
+      acc = 0.0f;
+      for (k = 0U; k < MAT_DIM; k++) {
+        acc += MatA[(r * MAT_DIM) + k] * MatB[(k * MAT_DIM) + c];
+      }
+      MatC[(r * MAT_DIM) + c] = acc;
+    }
+  }
+  return (FloatBits(MatC[0]) ^ FloatBits(MatC[(MAT_DIM * MAT_DIM) - 1U]));
+}
+
+const Kernel_t Kernels[] = {
+  { "memcpy",     Kernel_Memcpy,    Check_DstBuf, BUF_SIZE                               },
+  { "copy_words", Kernel_CopyWords, Check_DstBuf, BUF_SIZE                               },
+  { "crc32",      Kernel_Crc32,     NULL,         BUF_SIZE                               },
+  { "fir_f32",    Kernel_FirF32,    NULL,         FIR_SAMPLES * sizeof(float)            },
+  { "dot_q15",    Kernel_DotQ15,    NULL,         DOT_SIZE * 2U * sizeof(int16_t)        },
+  { "matmul_f32", Kernel_MatMulF32, NULL,         MAT_DIM * MAT_DIM * 2U * sizeof(float) }
+};
+
+const uint32_t KernelCount = sizeof(Kernels) / sizeof(Kernels[0]);
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef KERNELS_H_
+#define KERNELS_H_
+
+#include <stdint.h>
+
+/* Benchmark kernel descriptor */
+typedef struct {
+  const char *name;                     /* Kernel name */
+  uint32_t  (*run)(void);               /* Run kernel once, returns result checksum (timed) */
+  uint32_t  (*check)(void);             /* Result checksum outside the timed run, NULL: use run() result */
+  uint32_t    bytes;                    /* Bytes processed per run */
+} Kernel_t;
+
+extern const Kernel_t Kernels[];        /* Fixed kernel set, identical on all toolchains and host */
+extern const uint32_t KernelCount;
+
+/* Initialize kernel input data (deterministic) */
+extern void Kernels_Init (void);
+
+#endif /* KERNELS_H_ */
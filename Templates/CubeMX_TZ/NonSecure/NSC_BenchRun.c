@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Secure call latency benchmark
+ *
+ * Call NSC_Bench_Run() from the non-secure main() after the CubeMX
+ * initialization. Cycles are measured with DWT CYCCNT (secure
+ * non-invasive debug must be enabled so that CYCCNT counts in secure
+ * state) and reported via ITM stimulus port 0 as cycles per call and,
+ * for the buffer strategies, cycles per byte (x100).
+ */
+
+#include <stdio.h>
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "NSC_Bench.h"
+
+#define CALLS           64U             /* Calls per measurement */
+
+static const uint32_t BufSize[] = { 16U, 64U, 256U, NSC_BENCH_BUF_MAX };
+#define BUF_SIZES       (sizeof(BufSize) / sizeof(BufSize[0]))
+
+static uint8_t Buf[NSC_BENCH_BUF_MAX];
+
+typedef uint32_t (*BufFunc_t) (const void *buf, uint32_t len);
+
+static uint32_t BufShared (const void *buf, uint32_t len) {
+  (void)buf;
+  return (NSC_Bench_BufShared(len));
+}
+
+static const struct {
+  const char *name;
+  BufFunc_t   func;
+} BufStrategy[] = {
+  { "copy",     NSC_Bench_BufCopy    },
+  { "in-place", NSC_Bench_BufInPlace },
+  { "shared",   BufShared            }
+};
+
+static void Print (const char *str) {
+  while (*str != '\0') {
+    (void)ITM_SendChar((uint32_t)*str++);
+  }
+}
+
+/* Cycles per call, averaged over CALLS calls */
+#define MEASURE(result, call)                   \
+  do {                                          \
+    uint32_t n_, t0_ = DWT->CYCCNT;             \
+    for (n_ = 0U; n_ < CALLS; n_++) {           \
+      (void)(call);                             \
+    }                                           \
+    (result) = (DWT->CYCCNT - t0_) / CALLS;     \
+  } while (0)
+
+void NSC_Bench_Run (void) {
+  char     line[96];
+  uint32_t cyc[BUF_SIZES];
+  uint32_t i, s;
+  uint32_t c0, c1, c4;
+
+  for (i = 0U; i < NSC_BENCH_BUF_MAX; i++) {
+    Buf[i] = (uint8_t)i;
+  }
+
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;                   /* Enable DWT */
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;                 /* Start cycle counter */
+
+  MEASURE(c0, NSC_Bench_Call0());
+  MEASURE(c1, NSC_Bench_Call1(1U));
+  MEASURE(c4, NSC_Bench_Call4(1U, 2U, 3U, 4U));
+
+  (void)snprintf(line, sizeof(line), "NSC call cycles: 0 args %u, 1 arg %u, 4 args %u\n",
+                 (unsigned int)c0, (unsigned int)c1, (unsigned int)c4);
+  Print(line);
+
+  (void)NSC_Bench_BufShare(Buf, NSC_BENCH_BUF_MAX);     /* Validate shared buffer once */
+
+  (void)snprintf(line, sizeof(line), "%-10s %8u %8u %8u %8u %10s\n", "strategy",
+                 (unsigned int)BufSize[0], (unsigned int)BufSize[1],
+                 (unsigned int)BufSize[2], (unsigned int)BufSize[3], "x100/byte");
+  Print(line);
+
+  for (s = 0U; s < (sizeof(BufStrategy) / sizeof(BufStrategy[0])); s++) {
+    for (i = 0U; i < BUF_SIZES; i++) {
+      MEASURE(cyc[i], BufStrategy[s].func(Buf, BufSize[i]));
+    }
+    (void)snprintf(line, sizeof(line), "%-10s %8u %8u %8u %8u %10u\n", BufStrategy[s].name,
+                   (unsigned int)cyc[0], (unsigned int)cyc[1], (unsigned int)cyc[2], (unsigned int)cyc[3],
+                   (unsigned int)(((cyc[BUF_SIZES - 1U] - cyc[0]) * 100U) / (BufSize[BUF_SIZES - 1U] - BufSize[0])));
+    Print(line);
+  }
+}
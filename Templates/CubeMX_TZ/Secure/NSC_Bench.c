@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Non-secure callable benchmark functions
+ *
+ * Every function touches the passed data so that the measured cost
+ * contains the secure gateway (SG/BXNS), argument and register
+ * clearing as well as the selected buffer marshalling strategy.
+ */
+
+#include <string.h>
+#include <arm_cmse.h>
+#include "NSC_Bench.h"
+
+static uint8_t        SecureBuf[NSC_BENCH_BUF_MAX];     /* Secure copy of non-secure data */
+static const uint8_t *SharedBuf;                        /* Validated non-secure buffer */
+static uint32_t       SharedLen;
+
+/* Sum of bytes, processing done on the secure side */
+static uint32_t Process (const uint8_t *p, uint32_t len) {
+  uint32_t sum = 0U;
+
+  while (len--) {
+    sum += *p++;
+  }
+  return (sum);
+}
+
+/* Check that the buffer is completely non-secure and readable */
+static const uint8_t *CheckBuf (const void *buf, uint32_t len) {
+  if ((len == 0U) || (len > NSC_BENCH_BUF_MAX)) {
+    return (NULL);
+  }
+  return ((const uint8_t *)cmse_check_address_range((void *)buf, len, CMSE_NONSECURE | CMSE_MPU_READ));
+}
+
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_Call0 (void) {
+  return (0U);
+}
+
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_Call1 (uint32_t a) {
+  return (a);
+}
+
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_Call4 (uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+  return (a + b + c + d);
+}
+
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_BufCopy (const void *buf, uint32_t len) {
+  const uint8_t *p = CheckBuf(buf, len);
+
+  if (p == NULL) {
+    return (0U);
+  }
+  memcpy(SecureBuf, p, len);                            /* Protect against later non-secure changes */
+  return (Process(SecureBuf, len));
+}
+
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_BufInPlace (const void *buf, uint32_t len) {
+  const uint8_t *p = CheckBuf(buf, len);
+
+  if (p == NULL) {
+    return (0U);
+  }
+  return (Process(p, len));
+}
+
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_BufShare (const void *buf, uint32_t len) {
+  SharedBuf = CheckBuf(buf, len);
+  SharedLen = (SharedBuf != NULL) ? len : 0U;
+  return (SharedLen);
+}
+
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_BufShared (uint32_t len) {
+  if (len > SharedLen) {
+    return (0U);
+  }
+  return (Process(SharedBuf, len));
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NSC_BENCH_H_
+#define NSC_BENCH_H_
+
+#include <stdint.h>
+
+#define NSC_BENCH_BUF_MAX   1024U       /* Largest buffer passed to the secure side */
+
+/* Non-secure callable functions provided by the Secure project */
+
+/* Empty call, round-trip cost of the secure gateway */
+extern uint32_t NSC_Bench_Call0 (void);
+
+/* Call with 1 and 4 register arguments */
+extern uint32_t NSC_Bench_Call1 (uint32_t a);
+extern uint32_t NSC_Bench_Call4 (uint32_t a, uint32_t b, uint32_t c, uint32_t d);
+
+/* Buffer marshalling: validate and copy into secure memory, then process */
+extern uint32_t NSC_Bench_BufCopy (const void *buf, uint32_t len);
+
+/* Buffer marshalling: validate and process in place */
+extern uint32_t NSC_Bench_BufInPlace (const void *buf, uint32_t len);
+
+/* Buffer marshalling: validate a shared buffer once, later calls pass only the length */
+extern uint32_t NSC_Bench_BufShare  (const void *buf, uint32_t len);
+extern uint32_t NSC_Bench_BufShared (uint32_t len);
+
+/* Benchmark driver in the NonSecure project, reports via ITM stimulus port 0 */
+extern void NSC_Bench_Run (void);
+
+#endif /* NSC_BENCH_H_ */
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Representative firmware image corpus
+ *
+ * All variants are generated from a fixed seed, so the same szDev
+ * always yields the same images and the benchmark table is stable.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Corpus.h"
+
+#define KB(n)           ((n) * 1024U)
+#define MIN(a, b)       (((a) < (b)) ? (a) : (b))
+
+static const char *const CorpusName[CORPUS_VARIANTS] = {
+  "dense", "code", "sparse", "bank", "mixed"
+};
+
+/* Deterministic pseudo random sequence (xorshift32) */
+static uint32_t Rand (uint32_t *state) {
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return (x);
+}
+
+static void Put16 (uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void Put32 (uint8_t *p, uint32_t v) {
+  Put16(&p[0], v);
+  Put16(&p[2], v >> 16);
+}
+
+static void FillRandom (uint8_t *p, uint32_t size, uint32_t *seed) {
+  uint32_t i;
+
+  for (i = 0U; i < size; i++) {
+    p[i] = (uint8_t)Rand(seed);
+  }
+}
+
+/* Thumb-2 like code: vector table, functions with literal pools, const data */
+static void FillCode (uint8_t *p, uint32_t size, uint32_t base, uint32_t *seed) {
+  /* frequent 16-bit encodings: ldr/str imm, movs, adds, cmp, bcc, mov, lsls */
+  static const uint16_t Op16[] = {
+    0x6800U, 0x6000U, 0x2000U, 0x3000U, 0x2800U, 0xD000U, 0xD100U, 0x4600U, 0x0000U, 0x1C00U
+  };
+  uint32_t pos = 0U, codeEnd, n, r;
+
+  memset(p, 0xFF, size);
+
+  for (pos = 0U; (pos < 0x200U) && ((pos + 4U) <= size); pos += 4U) {   /* vector table */
+    Put32(&p[pos], (pos == 0U) ? 0x200A0000U : ((base + 0x200U + ((Rand(seed) & 0x3FFU) << 2)) | 1U));
+  }
+
+  codeEnd = (size / 5U) * 4U;                           /* 80 % code, 20 % const data */
+  while ((pos + 256U) <= codeEnd) {
+    Put16(&p[pos], 0xB5F0U);                            /* push {r4-r7,lr} */
+    pos += 2U;
+    for (n = 8U + (Rand(seed) % 48U); n != 0U; n--) {
+      r = Rand(seed);
+      if ((r & 0x7U) == 0U) {                           /* bl / ldr.w (32-bit) */
+        Put16(&p[pos], ((r & 0x8U) != 0U) ? (0xF000U | ((r >> 8) & 0x7FFU)) : 0xF8D0U);
+        Put16(&p[pos + 2U], ((r & 0x8U) != 0U) ? (0xF800U | ((r >> 20) & 0x7FFU)) : ((r >> 16) & 0x0FFFU));
+        pos += 4U;
+      } else {
+        Put16(&p[pos], Op16[(r >> 4) % (sizeof(Op16) / sizeof(Op16[0]))] | ((r >> 16) & 0xFFU));
+        pos += 2U;
+      }
+    }
+    Put16(&p[pos], 0xBDF0U);                            /* pop {r4-r7,pc} */
+    pos += 2U;
+    if ((pos & 2U) != 0U) {
+      Put16(&p[pos], 0xBF00U);                          /* nop (align) */
+      pos += 2U;
+    }
+    for (n = Rand(seed) % 5U; n != 0U; n--) {           /* literal pool */
+      r = Rand(seed);
+      switch (r & 3U) {
+        case 0U:  Put32(&p[pos], 0x40020000U | ((r >> 8) & 0xFFFCU)); break;
+        case 1U:  Put32(&p[pos], 0x20000000U | ((r >> 8) & 0xFFFCU)); break;
+        case 2U:  Put32(&p[pos], base | ((r >> 8) & 0x3FFFCU));       break;
+        default:  Put32(&p[pos], (r >> 8) & 0xFFU);                   break;
+      }
+      pos += 4U;
+    }
+  }
+
+  while (pos < size) {                                  /* const data: strings, tables, zero init */
+    r = Rand(seed);
+    n = MIN(16U + (r % 112U), size - pos);
+    if ((r & 0x300U) == 0U) {
+      memset(&p[pos], 0, n);
+    } else if ((r & 0x300U) == 0x100U) {
+      for (; n != 0U; n--) {
+        p[pos++] = (uint8_t)(0x20U + (Rand(seed) % 0x5FU));
+      }
+      continue;
+    } else {
+      FillRandom(&p[pos], n, seed);
+    }
+    pos += n;
+  }
+}
+
+static int AddSeg (CorpusImage_t *img, uint32_t offset, uint32_t size, uint8_t alias) {
+  CorpusSeg_t *seg = &img->seg[img->nSeg];
+
+  seg->data = malloc(size);
+  if (seg->data == NULL) {
+    return (1);
+  }
+  seg->offset = offset;
+  seg->size   = size;
+  seg->alias  = alias;
+  img->nSeg++;
+  return (0);
+}
+
+int Corpus_Generate (CorpusImage_t *img, uint32_t variant, uint32_t szDev) {
+  uint32_t seed = 0x5EED0000U + variant;
+  uint32_t size, ofs;
+
+  memset(img, 0, sizeof(*img));
+  if ((variant >= CORPUS_VARIANTS) || (szDev < KB(64U))) {
+    return (1);
+  }
+  img->name = CorpusName[variant];
+
+  switch (variant) {
+    case CORPUS_DENSE:
+      size = MIN(KB(512U), szDev / 2U);
+      if (AddSeg(img, 0U, size, CORPUS_ANY) != 0) {
+        break;
+      }
+      FillRandom(img->seg[0].data, size, &seed);
+      return (0);
+
+    case CORPUS_CODE:
+      size = MIN(KB(384U), (szDev / 8U) * 3U);
+      if (AddSeg(img, 0U, size, CORPUS_ANY) != 0) {
+        break;
+      }
+      FillCode(img->seg[0].data, size, 0x08000000U, &seed);
+      return (0);
+
+    case CORPUS_SPARSE:                                 /* 2K chunk every 64K, gaps are holes */
+      size = MIN(KB(1024U), szDev);
+      for (ofs = 0U; ofs < size; ofs += KB(64U)) {
+        if (AddSeg(img, ofs, KB(2U), CORPUS_ANY) != 0) {
+          break;
+        }
+        FillRandom(img->seg[img->nSeg - 1U].data, KB(2U), &seed);
+      }
+      if (ofs < size) {
+        break;
+      }
+      return (0);
+
+    case CORPUS_BANK:                                   /* centered on szDev / 2 */
+      size = MIN(KB(256U), szDev / 2U);
+      if (AddSeg(img, (szDev / 2U) - (size / 2U), size, CORPUS_ANY) != 0) {
+        break;
+      }
+      FillCode(img->seg[0].data, size, 0x08000000U + (szDev / 2U) - (size / 2U), &seed);
+      return (0);
+
+    case CORPUS_MIXED:                                  /* secure boot part + non-secure application */
+      size = MIN(KB(64U), szDev / 8U);
+      if (AddSeg(img, 0U, size, CORPUS_SECURE) != 0) {
+        break;
+      }
+      FillCode(img->seg[0].data, size, 0x0C000000U, &seed);
+      size = MIN(KB(256U), szDev / 2U);
+      if (AddSeg(img, szDev / 4U, size, CORPUS_NSECURE) != 0) {
+        break;
+      }
+      FillCode(img->seg[1].data, size, 0x08000000U + (szDev / 4U), &seed);
+      return (0);
+
+    default:
+      break;
+  }
+
+  Corpus_Free(img);
+  return (1);
+}
+
+void Corpus_Free (CorpusImage_t *img) {
+  uint32_t i;
+
+  for (i = 0U; i < img->nSeg; i++) {
+    free(img->seg[i].data);
+    img->seg[i].data = NULL;
+  }
+  img->nSeg = 0U;
+}
+
+/* Intel HEX record */
+static void HexRecord (FILE *f, uint32_t type, uint32_t adr, const uint8_t *data, uint32_t len) {
+  uint32_t i, sum;
+
+  sum = len + ((adr >> 8) & 0xFFU) + (adr & 0xFFU) + type;
+  fprintf(f, ":%02X%04X%02X", (unsigned int)len, (unsigned int)(adr & 0xFFFFU), (unsigned int)type);
+  for (i = 0U; i < len; i++) {
+    fprintf(f, "%02X", data[i]);
+    sum += data[i];
+  }
+  fprintf(f, "%02X\n", (unsigned int)((0x100U - (sum & 0xFFU)) & 0xFFU));
+}
+
+int Corpus_WriteHex (const CorpusImage_t *img, const char *path) {
+  FILE    *f;
+  uint32_t i, ofs, adr, len, upper = 0xFFFFFFFFU;
+  uint8_t  ext[2];
+
+  f = fopen(path, "w");
+  if (f == NULL) {
+    return (1);
+  }
+  for (i = 0U; i < img->nSeg; i++) {
+    const CorpusSeg_t *seg = &img->seg[i];
+
+    for (ofs = 0U; ofs < seg->size; ofs += len) {
+      adr = ((seg->alias == CORPUS_SECURE) ? 0x0C000000U : 0x08000000U) + seg->offset + ofs;
+      len = MIN(16U, seg->size - ofs);
+      if ((adr >> 16) != upper) {                       /* Extended Linear Address */
+        upper  = adr >> 16;
+        ext[0] = (uint8_t)(upper >> 8);
+        ext[1] = (uint8_t)upper;
+        HexRecord(f, 4U, 0U, ext, 2U);
+      }
+      HexRecord(f, 0U, adr, &seg->data[ofs], len);
+    }
+  }
+  HexRecord(f, 1U, 0U, NULL, 0U);
+  return ((fclose(f) == 0) ? 0 : 1);
+}
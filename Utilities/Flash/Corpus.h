@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORPUS_H_
+#define CORPUS_H_
+
+#include <stdint.h>
+
+/* Segment placement */
+#define CORPUS_ANY      0U              /* relocated to the alias of the used .FLM */
+#define CORPUS_SECURE   1U              /* secure alias only (0x0C000000) */
+#define CORPUS_NSECURE  2U              /* non-secure alias only (0x08000000) */
+
+#define CORPUS_SEG_MAX  16U
+
+typedef struct {
+  uint32_t offset;                      /* Offset to flash start */
+  uint32_t size;                        /* Size in bytes */
+  uint8_t  alias;                       /* CORPUS_ANY, CORPUS_SECURE, CORPUS_NSECURE */
+  uint8_t *data;
+} CorpusSeg_t;
+
+typedef struct {
+  const char  *name;                    /* Variant name */
+  uint32_t     nSeg;
+  CorpusSeg_t  seg[CORPUS_SEG_MAX];
+} CorpusImage_t;
+
+/* Image variants */
+#define CORPUS_DENSE    0U              /* dense random data */
+#define CORPUS_CODE     1U              /* typical Cortex-M33 Thumb-2 code and const data */
+#define CORPUS_SPARSE   2U              /* small chunks with large unprogrammed gaps */
+#define CORPUS_BANK     3U              /* straddles the bank boundary at szDev / 2 */
+#define CORPUS_MIXED    4U              /* secure and non-secure part */
+#define CORPUS_VARIANTS 5U
+
+/* Generate variant for a flash of szDev bytes (deterministic)
+     Return Value: 0 - OK, 1 - Failed */
+extern int  Corpus_Generate (CorpusImage_t *img, uint32_t variant, uint32_t szDev);
+extern void Corpus_Free     (CorpusImage_t *img);
+
+/* Write image as Intel HEX, CORPUS_ANY segments are placed at the non-secure alias
+     Return Value: 0 - OK, 1 - Failed */
+extern int  Corpus_WriteHex (const CorpusImage_t *img, const char *path);
+
+#endif /* CORPUS_H_ */
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Crc32.h"
+
+static uint32_t CrcTab[256];
+
+uint32_t Crc32 (uint32_t crc, const uint8_t *buf, size_t len) {
+  uint32_t i, j, c;
+
+  if (CrcTab[1] == 0U) {                                /* Build table once */
+    for (i = 0U; i < 256U; i++) {
+      c = i;
+      for (j = 0U; j < 8U; j++) {
+        c = ((c & 1U) != 0U) ? ((c >> 1) ^ 0xEDB88320U) : (c >> 1);
+      }
+      CrcTab[i] = c;
+    }
+  }
+
+  crc = ~crc;
+  while (len--) {
+    crc = CrcTab[(crc ^ *buf++) & 0xFFU] ^ (crc >> 8);
+  }
+  return (~crc);
+}
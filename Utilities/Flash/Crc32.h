@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CRC32_H_
+#define CRC32_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* CRC-32 (IEEE 802.3, reflected, polynomial 0xEDB88320), same as zlib crc32
+   and Crc32/CrcRange/FlashCrc in CMSIS/Flash/STM32H5xx/FlashPrg.c
+     crc: CRC of the preceding data (0 for start)
+     Return Value: CRC including buf */
+extern uint32_t Crc32 (uint32_t crc, const uint8_t *buf, size_t len);
+
+#endif /* CRC32_H_ */
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * End-to-end flashing benchmark
+ *
+ * Replays every corpus variant through Init/EraseSector/ProgramPage/UnInit
+ * of the modeled flash controller, in the same order a debugger uses the
+ * FlashOS interface (erase all touched sectors, then program all pages).
+ * Column 'stream s' replays the same image with ProgramStream calls
+ * instead of ProgramPage per page: one call per segment, split so that
+ * each call stays below toProg / 2, as the debugger times out the whole
+ * call with toProg.
+ *
+ * Usage: FlashBench [-t name=value]... [-w dir] [file.FLM]...
+ *   -t   override timing model parameter (see FlashTiming_Parse)
+ *   -w   write the corpus as Intel HEX files into dir
+ *   without .FLM the STM32H5xx 2M non-secure geometry is used
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FlmDevice.h"
+#include "FlashModel.h"
+#include "Corpus.h"
+
+#define STREAM_RING     4096U           /* ProgramStream ring data area (FlashStream_t.size) */
+
+typedef struct {
+  uint32_t bytes;                       /* Image bytes handled by the .FLM */
+} Result_t;
+
+/* Segment belongs to the address alias of the .FLM */
+static int SegMatch (const FlmDevice_t *dev, const CorpusSeg_t *seg) {
+  uint32_t secure = ((dev->devAdr & 0x04000000U) != 0U) ? 1U : 0U;
+
+  return ((seg->alias == CORPUS_ANY) ||
+          ((seg->alias == CORPUS_SECURE)  && (secure == 1U)) ||
+          ((seg->alias == CORPUS_NSECURE) && (secure == 0U)));
+}
+
+static int Replay (FlashModel_t *m, const CorpusImage_t *img, Result_t *res, int stream) {
+  const FlmDevice_t *dev = m->dev;
+  uint8_t  *page, *erased, *image = NULL;
+  uint32_t  i, adr, end, sz, ofs, n, start, pos, lim;
+  int       ret = 0;
+
+  page   = malloc(dev->szPage);
+  erased = calloc(dev->szDev / 1024U, 1U);              /* erased sector start marks, 1K granule */
+  if ((page == NULL) || (erased == NULL)) {
+    free(page);
+    free(erased);
+    return (1);
+  }
+  res->bytes = 0U;
+
+  (void)FlashModel_Init(m, dev->devAdr, 0U, 1U);        /* Erase */
+  for (i = 0U; i < img->nSeg; i++) {
+    const CorpusSeg_t *seg = &img->seg[i];
+
+    if (!SegMatch(dev, seg) || (seg->offset >= dev->szDev)) {
+      continue;
+    }
+    end = dev->devAdr + seg->offset + seg->size;
+    for (adr = dev->devAdr + seg->offset; adr < end; adr += sz) {
+      adr = FlmDevice_Sector(dev, adr, &sz);
+      if (sz == 0U) {
+        break;
+      }
+      if (erased[(adr - dev->devAdr) / 1024U] == 0U) {
+        erased[(adr - dev->devAdr) / 1024U] = 1U;
+        ret |= FlashModel_EraseSector(m, adr);
+      }
+    }
+  }
+  (void)FlashModel_UnInit(m, 1U);
+
+  (void)FlashModel_Init(m, dev->devAdr, 0U, 2U);        /* Program */
+  for (i = 0U; i < img->nSeg; i++) {
+    const CorpusSeg_t *seg = &img->seg[i];
+
+    if (!SegMatch(dev, seg) || (seg->offset >= dev->szDev)) {
+      continue;
+    }
+    end   = dev->devAdr + seg->offset + seg->size;
+    start = (dev->devAdr + seg->offset) & ~(dev->szPage - 1U);
+    if ((stream != 0) && ((image = realloc(image, end - start + dev->szPage)) == NULL)) {
+      ret = 1;
+      break;
+    }
+    for (adr = start; adr < end; adr += dev->szPage) {
+      memset(page, dev->valEmpty, dev->szPage);
+      for (n = 0U; n < dev->szPage; n++) {
+        ofs = adr + n - (dev->devAdr + seg->offset);
+        if (((adr + n) >= (dev->devAdr + seg->offset)) && (ofs < seg->size)) {
+          page[n] = seg->data[ofs];
+        }
+      }
+      if (stream == 0) {
+        ret |= FlashModel_ProgramPage(m, adr, dev->szPage, page);
+      } else {
+        memcpy(&image[adr - start], page, dev->szPage);
+      }
+    }
+    if (stream != 0) {                                  /* segment in calls below toProg */
+      lim = FlashModel_StreamLimit(m, STREAM_RING);
+      for (pos = 0U; pos < (adr - start); pos += n) {
+        n = ((adr - start - pos) < lim) ? (adr - start - pos) : lim;
+        ret |= FlashModel_ProgramStream(m, start + pos, n, STREAM_RING, &image[pos]);
+      }
+    }
+    res->bytes += seg->size;
+  }
+  (void)FlashModel_UnInit(m, 2U);
+
+  free(image);
+  free(page);
+  free(erased);
+  return (ret);
+}
+
+static const char *BaseName (const char *path) {
+  const char *p = strrchr(path, '/');
+
+  return ((p != NULL) ? (p + 1) : path);
+}
+
+int main (int argc, char *argv[]) {
+  FlashTiming_t timing = FlashTiming_Default;
+  FlmDevice_t  *dev;
+  FlashModel_t  model;
+  CorpusImage_t img;
+  Result_t      res = { 0U };
+  double        tStream;
+  const char   *dir = NULL;
+  const char   *flm[64];
+  uint32_t      nFlm = 0U, f, v;
+  char          path[512];
+  int           i, ret = 0;
+
+  for (i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-t") == 0) && ((i + 1) < argc)) {
+      if (FlashTiming_Parse(&timing, argv[++i]) != 0) {
+        fprintf(stderr, "Invalid timing parameter: %s\n", argv[i]);
+        return (2);
+      }
+    } else if ((strcmp(argv[i], "-w") == 0) && ((i + 1) < argc)) {
+      dir = argv[++i];
+    } else if ((argv[i][0] != '-') && (nFlm < (sizeof(flm) / sizeof(flm[0])))) {
+      flm[nFlm++] = argv[i];
+    } else {
+      fprintf(stderr, "Usage: %s [-t name=value]... [-w dir] [file.FLM]...\n", argv[0]);
+      return (2);
+    }
+  }
+
+  dev = malloc(sizeof(*dev));
+  if (dev == NULL) {
+    return (1);
+  }
+
+  printf("%-8s %-30s %9s %6s %6s %9s %9s %8s %9s\n",
+         "variant", "algorithm", "bytes", "erase", "pages", "est. s", "bytes/s", "timeout", "stream s");
+
+  for (f = 0U; f < ((nFlm != 0U) ? nFlm : 1U); f++) {
+    if (nFlm == 0U) {
+      FlmDevice_Default(dev, 0x08000000U, 0x00200000U);
+    } else if (FlmDevice_Load(flm[f], dev) != 0) {
+      fprintf(stderr, "Cannot read FlashDevice from %s\n", flm[f]);
+      ret = 1;
+      continue;
+    }
+
+    for (v = 0U; v < CORPUS_VARIANTS; v++) {
+      if (Corpus_Generate(&img, v, dev->szDev) != 0) {
+        fprintf(stderr, "Cannot generate corpus variant %u\n", (unsigned int)v);
+        ret = 1;
+        continue;
+      }
+      if ((dir != NULL) && (f == 0U)) {
+        snprintf(path, sizeof(path), "%s/%s_%uK.hex", dir, img.name, (unsigned int)(dev->szDev >> 10));
+        if (Corpus_WriteHex(&img, path) != 0) {
+          fprintf(stderr, "Cannot write %s\n", path);
+          ret = 1;
+        }
+      }
+      if (FlashModel_Create(&model, dev, &timing, dev->valEmpty) != 0) {
+        Corpus_Free(&img);
+        ret = 1;
+        continue;
+      }
+      if (Replay(&model, &img, &res, 1) != 0) {
+        ret = 1;
+      }
+      tStream = model.time;
+      FlashModel_Destroy(&model);
+      if (FlashModel_Create(&model, dev, &timing, dev->valEmpty) != 0) {
+        Corpus_Free(&img);
+        ret = 1;
+        continue;
+      }
+      if (Replay(&model, &img, &res, 0) != 0) {
+        ret = 1;
+      }
+      printf("%-8s %-30s %9u %6u %6u %9.3f %9.0f %8u %9.3f\n",
+             img.name, (nFlm != 0U) ? BaseName(flm[f]) : dev->devName,
+             (unsigned int)res.bytes, (unsigned int)model.nErase, (unsigned int)model.nProgram,
+             model.time, (model.time > 0.0) ? ((double)res.bytes / model.time) : 0.0,
+             (unsigned int)model.nTimeout, tStream);
+      FlashModel_Destroy(&model);
+      Corpus_Free(&img);
+    }
+  }
+
+  free(dev);
+  return (ret);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Expected CRC-32 of an image for the inline CRC check
+ *
+ * With FlashCrcMode = 1 the flash algorithm accumulates FlashCrc over
+ * every quad-word it programs, and CrcRange re-reads the programmed
+ * ranges on the target. Both are compared with the CRC printed here
+ * instead of reading back the image. Each image range is extended to
+ * page boundaries and padded with the erased value, as the debugger
+ * does for ProgramPage. Ranges are chained in address order.
+ *
+ * Usage: FlashCrc [-b adr] [-p page] [-f fill] image
+ *   -b   load address of a binary image
+ *   -p   page size (default 1024, use 16 for ProgramStream)
+ *   -f   padding value (default 0xFF)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Image.h"
+#include "Crc32.h"
+
+int main (int argc, char *argv[]) {
+  Image_t     img;
+  const char *path = NULL;
+  uint32_t    binAdr = 0U, page = 1024U, fill = 0xFFU;
+  uint32_t    i, start, end, next, crc, total = 0U;
+  uint8_t    *buf;
+  int         a;
+
+  for (a = 1; a < argc; a++) {
+    if ((strcmp(argv[a], "-b") == 0) && ((a + 1) < argc)) {
+      binAdr = (uint32_t)strtoul(argv[++a], NULL, 0);
+    } else if ((strcmp(argv[a], "-p") == 0) && ((a + 1) < argc)) {
+      page = (uint32_t)strtoul(argv[++a], NULL, 0);
+    } else if ((strcmp(argv[a], "-f") == 0) && ((a + 1) < argc)) {
+      fill = (uint32_t)strtoul(argv[++a], NULL, 0);
+    } else if ((argv[a][0] != '-') && (path == NULL)) {
+      path = argv[a];
+    } else {
+      path = NULL;
+      break;
+    }
+  }
+  if ((path == NULL) || (page < 16U) || ((page & (page - 1U)) != 0U) || (fill > 0xFFU)) {
+    fprintf(stderr, "Usage: %s [-b adr] [-p page] [-f fill] image\n", argv[0]);
+    return (2);
+  }
+  if (Image_Load(&img, path, binAdr) != 0) {
+    fprintf(stderr, "Cannot read image %s\n", path);
+    return (1);
+  }
+
+  printf("%-10s %-10s %-10s\n", "address", "size", "CRC-32");
+  for (i = 0U; i < img.nSeg; i = next) {
+    /* segments sharing a page form one range */
+    start = img.seg[i].adr & ~(page - 1U);
+    end   = (img.seg[i].adr + img.seg[i].size + (page - 1U)) & ~(page - 1U);
+    for (next = i + 1U; (next < img.nSeg) && (img.seg[next].adr < end); next++) {
+      end = (img.seg[next].adr + img.seg[next].size + (page - 1U)) & ~(page - 1U);
+    }
+    buf = malloc(end - start);
+    if (buf == NULL) {
+      Image_Free(&img);
+      return (1);
+    }
+    memset(buf, (int)fill, end - start);
+    for (; i < next; i++) {
+      memcpy(&buf[img.seg[i].adr - start], img.seg[i].data, img.seg[i].size);
+    }
+    crc   = Crc32(0U, buf, end - start);
+    total = Crc32(total, buf, end - start);
+    printf("0x%08X 0x%08X 0x%08X\n", (unsigned int)start, (unsigned int)(end - start), (unsigned int)crc);
+    free(buf);
+  }
+  printf("total                 0x%08X\n", (unsigned int)total);
+
+  Image_Free(&img);
+  return (0);
+}
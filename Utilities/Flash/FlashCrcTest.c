@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Inline CRC test
+ *
+ * Checks Crc32 against the CRC-32 check value and then programs an image
+ * the way the debugger does (touched pages padded with the erased value,
+ * address order) on the modeled controller. The non-secure and the secure
+ * alias of the 2M flash are programmed in one session each, the debugger
+ * chains FlashCrc into the second session. The FlashCrc accumulated by the
+ * model is printed, FlashCrcTest.sh compares it with the total of the
+ * FlashCrc tool.
+ *
+ * Usage: FlashCrcTest [-p page] image
+ *   -p   page size (default szPage, 16: ProgramStream instead of ProgramPage)
+ *   exit status 0 - OK, 1 - failed, 3 - image outside the 2M flash aliases
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FlmDevice.h"
+#include "FlashModel.h"
+#include "Image.h"
+#include "Crc32.h"
+
+#define STREAM_RING     4096U           /* ProgramStream ring data area */
+#define DEV_SIZE        0x00200000U     /* STM32H5xx_2048 */
+
+static const uint32_t Alias[2] = { 0x08000000U, 0x0C000000U };    /* non-secure, secure */
+
+/* CRC-32 check value, also computed in two chained parts */
+static int CheckValue (void) {
+  static const uint8_t chk[] = "123456789";
+
+  return ((Crc32(0U, chk, 9U) == 0xCBF43926U) &&
+          (Crc32(Crc32(0U, chk, 4U), &chk[4], 5U) == 0xCBF43926U) &&
+          (Crc32(0U, chk, 0U) == 0U));
+}
+
+/* Erase and program the image part in one flash alias, FlashCrc starts at *crc
+     Return Value: 0 - OK, 1 - Failed */
+static int ProgramAlias (const FlmDevice_t *dev, const Image_t *img, uint32_t page, uint32_t *crc) {
+  FlashModel_t  m;
+  uint8_t      *mem, *touched;
+  uint32_t      nPage = dev->szDev / page, i, j, ofs, run, ssz;
+  int           ret = 0;
+
+  mem     = malloc(dev->szDev);
+  touched = calloc(nPage, 1U);
+  if ((mem == NULL) || (touched == NULL) || (FlashModel_Create(&m, dev, NULL, dev->valEmpty) != 0)) {
+    free(touched);
+    free(mem);
+    return (1);
+  }
+  memset(mem, dev->valEmpty, dev->szDev);
+  for (i = 0U; i < img->nSeg; i++) {
+    if ((img->seg[i].adr < dev->devAdr) || ((img->seg[i].adr - dev->devAdr) >= dev->szDev)) {
+      continue;                                         /* other alias */
+    }
+    ofs = img->seg[i].adr - dev->devAdr;
+    memcpy(&mem[ofs], img->seg[i].data, img->seg[i].size);
+    for (j = ofs / page; j <= ((ofs + img->seg[i].size - 1U) / page); j++) {
+      touched[j] = 1U;
+    }
+  }
+
+  /* erase session: every sector with a touched page */
+  ret |= FlashModel_Init(&m, dev->devAdr, 0U, 1U);
+  for (ofs = 0U; ofs < dev->szDev; ofs += ssz) {
+    (void)FlmDevice_Sector(dev, dev->devAdr + ofs, &ssz);
+    for (j = ofs / page; j < ((ofs + ssz) / page); j++) {
+      if (touched[j] != 0U) {
+        ret |= FlashModel_EraseSector(&m, dev->devAdr + ofs);
+        break;
+      }
+    }
+  }
+  ret |= FlashModel_UnInit(&m, 1U);
+
+  /* program session: runs of touched pages in address order */
+  ret |= FlashModel_Init(&m, dev->devAdr, 0U, 2U);
+  m.crc = *crc;                                         /* debugger writes FlashCrc after Init */
+  for (j = 0U; j < nPage; j += (run != 0U) ? run : 1U) {
+    for (run = 0U; ((j + run) < nPage) && (touched[j + run] != 0U); run++);
+    if (run == 0U) {
+      continue;
+    }
+    if (page == dev->szPage) {
+      for (i = 0U; i < run; i++) {
+        ret |= FlashModel_ProgramPage(&m, dev->devAdr + ((j + i) * page), page, &mem[(j + i) * page]);
+      }
+    } else {
+      ret |= FlashModel_ProgramStream(&m, dev->devAdr + (j * page), run * page, STREAM_RING, &mem[j * page]);
+    }
+  }
+  *crc = m.crc;
+  ret |= FlashModel_UnInit(&m, 2U);
+
+  FlashModel_Destroy(&m);
+  free(touched);
+  free(mem);
+  return (ret);
+}
+
+int main (int argc, char *argv[]) {
+  FlmDevice_t  *dev;
+  Image_t       img;
+  const char   *path = NULL;
+  uint32_t      page = 0U, used = 0U, crc = 0U, i, k, ofs;
+  int           a, ret = 0;
+
+  for (a = 1; a < argc; a++) {
+    if ((strcmp(argv[a], "-p") == 0) && ((a + 1) < argc)) {
+      page = (uint32_t)strtoul(argv[++a], NULL, 0);
+    } else if ((argv[a][0] != '-') && (path == NULL)) {
+      path = argv[a];
+    } else {
+      path = NULL;
+      break;
+    }
+  }
+  if (!CheckValue()) {
+    fprintf(stderr, "Crc32 check value 0xCBF43926 failed\n");
+    return (1);
+  }
+  if (path == NULL) {
+    fprintf(stderr, "Usage: %s [-p page] image\n", argv[0]);
+    return (2);
+  }
+
+  dev = malloc(sizeof(*dev));
+  if (dev == NULL) {
+    return (1);
+  }
+  FlmDevice_Default(dev, Alias[0], DEV_SIZE);
+  if (page == 0U) {
+    page = dev->szPage;
+  }
+  if ((page < 16U) || (page > dev->szPage) || ((page & (page - 1U)) != 0U) ||
+      (Image_Load(&img, path, Alias[0]) != 0)) {
+    fprintf(stderr, "Invalid page size or image %s\n", path);
+    free(dev);
+    return (2);
+  }
+
+  for (i = 0U; i < img.nSeg; i++) {
+    for (k = 0U; k < 2U; k++) {
+      ofs = img.seg[i].adr - Alias[k];
+      if ((img.seg[i].adr >= Alias[k]) && (ofs < DEV_SIZE) && (img.seg[i].size <= (DEV_SIZE - ofs))) {
+        used |= 1U << k;
+        break;
+      }
+    }
+    if (k == 2U) {
+      ret = 3;                                          /* FlashCrc total would include it */
+    }
+  }
+
+  /* aliases in address order, FlashCrc chained by the debugger */
+  for (k = 0U; (ret == 0) && (k < 2U); k++) {
+    if ((used & (1U << k)) != 0U) {
+      FlmDevice_Default(dev, Alias[k], DEV_SIZE);
+      ret = ProgramAlias(dev, &img, page, &crc);
+    }
+  }
+  if (ret == 0) {
+    printf("0x%08X\n", (unsigned int)crc);
+  }
+
+  Image_Free(&img);
+  free(dev);
+  return (ret);
+}
@@ -0,0 +1,62 @@
+#!/bin/sh
+#
+# Copyright (c) 2026 Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+
+# Inline CRC check on the FlashBench corpus
+#
+# FlashCrcTest checks Crc32 against the check value 0xCBF43926 and prints
+# the FlashCrc the modeled controller accumulates while it programs the
+# image (ProgramPage, and ProgramStream with -p 16). It must equal the
+# total printed by the FlashCrc tool for the same page size. The mixed
+# images program the secure alias in a second session with FlashCrc chained.
+# FlashPrgTest crc (FlashPrgBuild.sh) runs the same with the target code of
+# FlashPrg.c, ProgramQuadWord and CrcRange; both of its CRCs must equal the
+# FlashCrc total as well.
+#
+# Usage: ./FlashCrcTest.sh [work dir]
+
+set -e
+cd "$(dirname "$0")"
+W=${1:-${TMPDIR:-/tmp}/FlashCrcTest}
+CC=${CC:-cc}
+
+mkdir -p "$W/corpus"
+$CC -O2 -o "$W/FlashBench"   FlashBench.c   FlashModel.c FlmDevice.c Crc32.c Corpus.c
+$CC -O2 -o "$W/FlashCrc"     FlashCrc.c     Crc32.c Image.c
+$CC -O2 -o "$W/FlashCrcTest" FlashCrcTest.c FlashModel.c FlmDevice.c Crc32.c Image.c
+./FlashPrgBuild.sh "$W/prg"
+"$W/FlashBench" -w "$W/corpus" > /dev/null
+
+fail=0
+for img in "$W"/corpus/*.hex; do
+  name=$(basename "$img" .hex)
+  for page in 1024 16; do
+    model=$("$W/FlashCrcTest" -p $page "$img") || model="error"
+    target=$("$W/prg/FlashPrgTest" crc -p $page "$img") || target="error"
+    tool=$("$W/FlashCrc" -p $page "$img" | awk '/^total/ { print $2 }')
+    if [ "$model" = "$tool" ] && [ "$target" = "$tool $tool" ]; then
+      echo "ok   $name -p $page $model"
+    else
+      echo "FAIL $name -p $page: model $model, target $target, FlashCrc $tool"
+      fail=1
+    fi
+  done
+done
+
+exit $fail
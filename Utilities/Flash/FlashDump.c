@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Flash dump codec
+ *
+ * Host side of Dump() in CMSIS/Flash/STM32H5xx/FlashPrg.c, token format
+ * and digests as described in CMSIS/Flash/STM32H5xx/FlashDump.h.
+ * A dump file is a 16 byte header ("FDMP", base, size, sector size, all
+ * 32-bit LE) followed by the token stream of all Dump() calls.
+ *
+ * Usage: FlashDump digest [-b adr] [-s size] golden file.dig
+ *          digest list of the golden image, loaded to target SRAM
+ *        FlashDump encode [-b adr] [-s size] [-g golden] [-n] [-m outSize] [-c callSize] image file.fdmp
+ *          reference encoder, same output as Dump() for the same content
+ *        FlashDump decode [-g golden] file.fdmp file.bin
+ *          decompress, 'same' sectors are taken from the golden image,
+ *          lists sectors that differ from golden
+ *   -b, -s  dump range (default: range of the image, sector aligned)
+ *   -n      no match search (Dump() without FLASH_DUMP_LZ)
+ *   -m      size of the SRAM output buffer per Dump() call (default 4096)
+ *   -c      sz per Dump() call (default: rest of the range), the stream
+ *           is the same for any callSize of at least one sector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Image.h"
+
+#include "../../CMSIS/Flash/STM32H5xx/FlashDump.h"
+
+#define HASH_BITS       10U             /* as DUMP_HASH_BITS in FlashPrg.c */
+#define FILL_VALUE      0xFFU           /* Erased flash */
+
+typedef struct {
+  uint32_t  base;
+  uint32_t  size;
+  uint8_t  *mem;                        /* size bytes, FILL_VALUE outside image */
+} Range_t;
+
+static uint32_t Rd32 (const uint8_t *p) {
+  return ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+static void Wr32 (uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t Digest (const uint8_t *p, uint32_t sz) {
+  uint32_t h = FLASH_DUMP_FNV_BASIS;
+
+  while (sz--) {
+    h = (h ^ *p++) * FLASH_DUMP_FNV_PRIME;
+  }
+  return (h);
+}
+
+/* Load image into range, base/size 0 = derive from image */
+static int LoadRange (const char *path, uint32_t base, uint32_t size, Range_t *r) {
+  Image_t  img;
+  uint32_t i, j, lo = 0xFFFFFFFFU, hi = 0U, ofs;
+
+  if (Image_Load(&img, path, base) != 0) {
+    return (1);
+  }
+  for (i = 0U; i < img.nSeg; i++) {
+    if (img.seg[i].adr < lo) { lo = img.seg[i].adr; }
+    if ((img.seg[i].adr + img.seg[i].size) > hi) { hi = img.seg[i].adr + img.seg[i].size; }
+  }
+  if (size == 0U) {
+    base = lo & ~(FLASH_DUMP_SECTOR - 1U);
+    size = ((hi - base) + (FLASH_DUMP_SECTOR - 1U)) & ~(FLASH_DUMP_SECTOR - 1U);
+  }
+  r->base = base;
+  r->size = size;
+  r->mem  = malloc((size != 0U) ? size : 1U);
+  if ((r->mem == NULL) || (img.nSeg == 0U)) {
+    free(r->mem);
+    Image_Free(&img);
+    return (1);
+  }
+  memset(r->mem, FILL_VALUE, size);
+  for (i = 0U; i < img.nSeg; i++) {
+    for (j = 0U; j < img.seg[i].size; j++) {
+      ofs = img.seg[i].adr + j - base;
+      if (ofs < size) {
+        r->mem[ofs] = img.seg[i].data[j];
+      }
+    }
+  }
+  Image_Free(&img);
+  return (0);
+}
+
+/* Emit pending literals [lit, pos) */
+static uint32_t Literal (uint8_t *out, const uint8_t *mem, uint32_t lit, uint32_t pos) {
+  uint32_t n = pos - lit;
+
+  if (n == 0U) {
+    return (0U);
+  }
+  out[0] = (uint8_t)(FLASH_DUMP_LIT | (n - 1U));
+  memcpy(&out[1], &mem[lit], n);
+  return (n + 1U);
+}
+
+/* One Dump() call on offsets to r->mem, same decisions as FlashPrg.c
+     Return Value: offset to continue, *outLen = output bytes */
+static uint32_t DumpCall (const Range_t *r, uint32_t adr, uint32_t sz, const uint32_t *digest, uint32_t nDigest,
+                          uint32_t flags, uint8_t *out, uint32_t outSize, uint32_t *outLen) {
+  static uint32_t hash[1U << HASH_BITS];
+  const uint8_t *m = r->mem;
+  uint32_t end = adr + sz, pos = adr, lit = adr, o = 0U;
+  uint32_t lim, idx, n, h, cand;
+
+  *outLen = 0U;
+  if (outSize < FLASH_DUMP_OUT_MIN) {
+    return (adr);
+  }
+  lim = end - (end % FLASH_DUMP_SECTOR);                /* Call ends at a sector boundary */
+  if (lim > adr) {
+    end = lim;
+  }
+  if (adr == 0U) {                                      /* Dump() clears its table at ctl->base */
+    memset(hash, 0, sizeof(hash));
+  }
+  while (pos < end) {
+    if ((outSize - o) < ((pos - lit) + 1U + 3U + 1U)) {
+      pos = lit;
+      break;
+    }
+    idx = pos / FLASH_DUMP_SECTOR;
+    lim = (idx + 1U) * FLASH_DUMP_SECTOR;
+    if (lim > end) {
+      lim = end;
+    }
+
+    if (((pos % FLASH_DUMP_SECTOR) == 0U) && (idx < nDigest) && ((end - pos) >= FLASH_DUMP_SECTOR) &&
+        (Digest(&m[pos], FLASH_DUMP_SECTOR) == digest[idx])) {
+      o += Literal(&out[o], m, lit, pos);
+      out[o++] = FLASH_DUMP_SAME;
+      pos += FLASH_DUMP_SECTOR;
+      lit  = pos;
+      continue;
+    }
+
+    for (n = 1U; ((pos + n) < lim) && (n < FLASH_DUMP_FILL_MAX) && (m[pos + n] == m[pos]); n++);
+    if (n >= 16U) {
+      n &= ~15U;
+      o += Literal(&out[o], m, lit, pos);
+      out[o++] = (uint8_t)(FLASH_DUMP_FILL | ((n / 16U) - 1U));
+      out[o++] = m[pos];
+      pos += n;
+      lit  = pos;
+      continue;
+    }
+
+    if (((flags & FLASH_DUMP_LZ) != 0U) && ((lim - pos) >= FLASH_DUMP_MATCH_MIN)) {
+      h    = Rd32(&m[pos]);
+      h    = (h * 0x9E3779B1U) >> (32U - HASH_BITS);
+      cand = hash[h];
+      hash[h] = pos + r->base;                          /* target stores addresses */
+      cand -= r->base;
+      if ((cand < pos) && ((pos - cand) <= FLASH_DUMP_OFFSET_MAX)) {
+        for (n = 0U; ((pos + n) < lim) && (n < FLASH_DUMP_MATCH_MAX) && (m[cand + n] == m[pos + n]); n++);
+        if (n >= FLASH_DUMP_MATCH_MIN) {
+          o += Literal(&out[o], m, lit, pos);
+          out[o++] = (uint8_t)(FLASH_DUMP_MATCH | (n - FLASH_DUMP_MATCH_MIN));
+          out[o++] = (uint8_t)(pos - cand);
+          out[o++] = (uint8_t)((pos - cand) >> 8);
+          pos += n;
+          lit  = pos;
+          continue;
+        }
+      }
+    }
+
+    pos++;
+    if (((pos - lit) == FLASH_DUMP_LIT_MAX) || (pos == lim)) {
+      o  += Literal(&out[o], m, lit, pos);
+      lit = pos;
+    }
+  }
+  o += Literal(&out[o], m, lit, pos);
+  *outLen = o;
+  return (pos);
+}
+
+/* Decode token stream into r->mem, 'same' sectors from golden
+     Return Value: 0 - OK, 1 - corrupt stream or missing golden */
+static int Decode (const uint8_t *in, uint32_t len, Range_t *r, const Range_t *golden, uint8_t *same) {
+  uint32_t i = 0U, pos = 0U, n, off, t;
+
+  while (pos < r->size) {
+    if (i >= len) {
+      return (1);
+    }
+    t = in[i++];
+    if (t < FLASH_DUMP_MATCH) {                         /* literal */
+      n = t + 1U;
+      if (((len - i) < n) || ((r->size - pos) < n)) {
+        return (1);
+      }
+      memcpy(&r->mem[pos], &in[i], n);
+      i += n;
+    } else if (t < FLASH_DUMP_FILL) {                   /* match */
+      n = (t & 0x3FU) + FLASH_DUMP_MATCH_MIN;
+      if ((len - i) < 2U) {
+        return (1);
+      }
+      off = in[i] | ((uint32_t)in[i + 1U] << 8);
+      i  += 2U;
+      if ((off == 0U) || (off > pos) || ((r->size - pos) < n)) {
+        return (1);
+      }
+      for (t = 0U; t < n; t++) {                        /* may overlap */
+        r->mem[pos + t] = r->mem[pos - off + t];
+      }
+    } else if (t != FLASH_DUMP_SAME) {                  /* fill */
+      n = ((t & 0x3FU) + 1U) * 16U;
+      if ((i >= len) || ((r->size - pos) < n)) {
+        return (1);
+      }
+      memset(&r->mem[pos], in[i++], n);
+    } else {                                            /* same as golden */
+      n = FLASH_DUMP_SECTOR;
+      if ((golden == NULL) || ((pos % n) != 0U) || ((r->size - pos) < n) ||
+          ((r->base + pos) < golden->base) || ((r->base + pos + n - golden->base) > golden->size)) {
+        return (1);
+      }
+      memcpy(&r->mem[pos], &golden->mem[r->base + pos - golden->base], n);
+      same[pos / n] = 1U;
+    }
+    pos += n;
+  }
+  return (0);
+}
+
+static uint8_t *ReadAll (const char *path, uint32_t *size) {
+  FILE    *f;
+  uint8_t *buf = NULL;
+  long     len;
+
+  f = fopen(path, "rb");
+  if (f == NULL) {
+    return (NULL);
+  }
+  if ((fseek(f, 0, SEEK_END) == 0) && ((len = ftell(f)) > 0) && (fseek(f, 0, SEEK_SET) == 0)) {
+    buf = malloc((size_t)len);
+    if ((buf != NULL) && (fread(buf, 1U, (size_t)len, f) != (size_t)len)) {
+      free(buf);
+      buf = NULL;
+    }
+    *size = (uint32_t)len;
+  }
+  fclose(f);
+  return (buf);
+}
+
+static int WriteAll (const char *path, const uint8_t *hdr, uint32_t hdrLen, const uint8_t *buf, uint32_t len) {
+  FILE *f = fopen(path, "wb");
+  int   ret = 0;
+
+  if (f == NULL) {
+    return (1);
+  }
+  if (((hdrLen != 0U) && (fwrite(hdr, 1U, hdrLen, f) != hdrLen)) || (fwrite(buf, 1U, len, f) != len)) {
+    ret = 1;
+  }
+  if (fclose(f) != 0) {
+    ret = 1;
+  }
+  return (ret);
+}
+
+static int CmdDigest (const char *golden, uint32_t base, uint32_t size, const char *out) {
+  Range_t  r;
+  uint8_t *dig;
+  uint32_t i, n;
+  int      ret;
+
+  if (LoadRange(golden, base, size, &r) != 0) {
+    fprintf(stderr, "Cannot read %s\n", golden);
+    return (1);
+  }
+  n   = r.size / FLASH_DUMP_SECTOR;
+  dig = malloc((n != 0U) ? (n * 4U) : 4U);
+  if (dig == NULL) {
+    free(r.mem);
+    return (1);
+  }
+  for (i = 0U; i < n; i++) {
+    Wr32(&dig[i * 4U], Digest(&r.mem[i * FLASH_DUMP_SECTOR], FLASH_DUMP_SECTOR));
+  }
+  ret = WriteAll(out, NULL, 0U, dig, n * 4U);
+  printf("%u digests for 0x%08X..0x%08X\n", (unsigned int)n, (unsigned int)r.base, (unsigned int)(r.base + r.size - 1U));
+  free(dig);
+  free(r.mem);
+  return (ret);
+}
+
+static int CmdEncode (const char *image, const char *golden, uint32_t base, uint32_t size,
+                      uint32_t flags, uint32_t outSize, uint32_t callSize, const char *out) {
+  Range_t   r, g;
+  uint32_t *dig = NULL, nDig = 0U, i, adr, sz, next, len, total = 0U, calls = 0U;
+  uint8_t  *stream, *chunk, hdr[16];
+  int       ret = 0;
+
+  if (LoadRange(image, base, size, &r) != 0) {
+    fprintf(stderr, "Cannot read %s\n", image);
+    return (1);
+  }
+  if (golden != NULL) {
+    if (LoadRange(golden, r.base, r.size, &g) != 0) {
+      fprintf(stderr, "Cannot read %s\n", golden);
+      free(r.mem);
+      return (1);
+    }
+    nDig = r.size / FLASH_DUMP_SECTOR;
+    dig  = malloc((nDig != 0U) ? (nDig * 4U) : 4U);
+    for (i = 0U; (dig != NULL) && (i < nDig); i++) {
+      dig[i] = Digest(&g.mem[i * FLASH_DUMP_SECTOR], FLASH_DUMP_SECTOR);
+    }
+    free(g.mem);
+  }
+  stream = malloc((r.size * 2U) + outSize);             /* worst case: literals */
+  chunk  = malloc(outSize);
+  if ((stream == NULL) || (chunk == NULL) || ((golden != NULL) && (dig == NULL))) {
+    ret = 1;
+    goto exit;
+  }
+
+  for (adr = 0U; adr < r.size; adr = next) {            /* host loop over Dump() calls */
+    sz   = r.size - adr;
+    if ((callSize != 0U) && (sz > callSize)) {
+      sz = callSize;
+    }
+    next = DumpCall(&r, adr, sz, dig, nDig, flags, chunk, outSize, &len);
+    if (next == adr) {
+      ret = 1;
+      goto exit;
+    }
+    memcpy(&stream[total], chunk, len);
+    total += len;
+    calls++;
+  }
+
+  memcpy(hdr, "FDMP", 4U);
+  Wr32(&hdr[4],  r.base);
+  Wr32(&hdr[8],  r.size);
+  Wr32(&hdr[12], FLASH_DUMP_SECTOR);
+  ret = WriteAll(out, hdr, sizeof(hdr), stream, total);
+  printf("0x%08X..0x%08X: %u bytes -> %u bytes (%.1f%%), %u calls\n",
+         (unsigned int)r.base, (unsigned int)(r.base + r.size - 1U), (unsigned int)r.size,
+         (unsigned int)total, (100.0 * total) / r.size, (unsigned int)calls);
+
+exit:
+  free(stream);
+  free(chunk);
+  free(dig);
+  free(r.mem);
+  return (ret);
+}
+
+static int CmdDecode (const char *in, const char *golden, const char *out) {
+  Range_t  r, g;
+  uint8_t *dump, *same;
+  uint32_t len = 0U, i, n, nSame = 0U, nDiff = 0U;
+  int      ret = 0;
+
+  dump = ReadAll(in, &len);
+  if ((dump == NULL) || (len < 16U) || (memcmp(dump, "FDMP", 4U) != 0) ||
+      (Rd32(&dump[12]) != FLASH_DUMP_SECTOR)) {
+    fprintf(stderr, "Invalid dump file %s\n", in);
+    free(dump);
+    return (1);
+  }
+  r.base = Rd32(&dump[4]);
+  r.size = Rd32(&dump[8]);
+  n      = (r.size + (FLASH_DUMP_SECTOR - 1U)) / FLASH_DUMP_SECTOR;
+  r.mem  = malloc((r.size != 0U) ? r.size : 1U);
+  same   = calloc((n != 0U) ? n : 1U, 1U);
+  g.mem  = NULL;
+  if ((r.mem == NULL) || (same == NULL) ||
+      ((golden != NULL) && (LoadRange(golden, r.base, r.size, &g) != 0))) {
+    fprintf(stderr, "Cannot read %s\n", (golden != NULL) ? golden : in);
+    ret = 1;
+    goto exit;
+  }
+  if (Decode(&dump[16], len - 16U, &r, (golden != NULL) ? &g : NULL, same) != 0) {
+    fprintf(stderr, "Corrupt dump stream%s\n", (golden == NULL) ? " or golden image required (-g)" : "");
+    ret = 1;
+    goto exit;
+  }
+  ret = WriteAll(out, NULL, 0U, r.mem, r.size);
+
+  for (i = 0U; i < n; i++) {
+    if (same[i] != 0U) {
+      nSame++;
+    } else if ((golden != NULL) &&
+               (memcmp(&r.mem[i * FLASH_DUMP_SECTOR], &g.mem[i * FLASH_DUMP_SECTOR],
+                       ((r.size - (i * FLASH_DUMP_SECTOR)) < FLASH_DUMP_SECTOR) ?
+                       (r.size - (i * FLASH_DUMP_SECTOR)) : FLASH_DUMP_SECTOR) != 0)) {
+      printf("differs: sector 0x%08X\n", (unsigned int)(r.base + (i * FLASH_DUMP_SECTOR)));
+      nDiff++;
+    }
+  }
+  printf("0x%08X..0x%08X: %u sectors, %u same by digest", (unsigned int)r.base,
+         (unsigned int)(r.base + r.size - 1U), (unsigned int)n, (unsigned int)nSame);
+  if (golden != NULL) {
+    printf(", %u differ from golden", (unsigned int)nDiff);
+  }
+  printf("\n");
+
+exit:
+  free(dump);
+  free(same);
+  free(r.mem);
+  free(g.mem);
+  return (ret);
+}
+
+int main (int argc, char *argv[]) {
+  const char *golden = NULL, *arg[2] = { NULL, NULL };
+  uint32_t    base = 0U, size = 0U, flags = FLASH_DUMP_LZ, outSize = 4096U, callSize = 0U, nArg = 0U;
+  int         i;
+
+  for (i = 2; i < argc; i++) {
+    if ((strcmp(argv[i], "-b") == 0) && ((i + 1) < argc)) {
+      base = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-s") == 0) && ((i + 1) < argc)) {
+      size = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-g") == 0) && ((i + 1) < argc)) {
+      golden = argv[++i];
+    } else if ((strcmp(argv[i], "-m") == 0) && ((i + 1) < argc)) {
+      outSize = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-c") == 0) && ((i + 1) < argc)) {
+      callSize = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "-n") == 0) {
+      flags &= ~FLASH_DUMP_LZ;
+    } else if ((argv[i][0] != '-') && (nArg < 2U)) {
+      arg[nArg++] = argv[i];
+    } else {
+      nArg = 0U;
+      break;
+    }
+  }
+  if ((argc >= 2) && (nArg == 2U) && (outSize >= FLASH_DUMP_OUT_MIN) &&
+      ((base % FLASH_DUMP_SECTOR) == 0U) && ((size % FLASH_DUMP_SECTOR) == 0U) && ((size != 0U) || (base == 0U))) {
+    if (strcmp(argv[1], "digest") == 0) {
+      return (CmdDigest(arg[0], base, size, arg[1]));
+    }
+    if (strcmp(argv[1], "encode") == 0) {
+      return (CmdEncode(arg[0], golden, base, size, flags, outSize, callSize, arg[1]));
+    }
+    if (strcmp(argv[1], "decode") == 0) {
+      return (CmdDecode(arg[0], golden, arg[1]));
+    }
+  }
+  fprintf(stderr, "Usage: %s digest [-b adr] [-s size] golden file.dig\n"
+                  "       %s encode [-b adr] [-s size] [-g golden] [-n] [-m outSize] [-c callSize] image file.fdmp\n"
+                  "       %s decode [-g golden] file.fdmp file.bin\n", argv[0], argv[0], argv[0]);
+  return (2);
+}
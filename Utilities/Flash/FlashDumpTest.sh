@@ -0,0 +1,91 @@
+#!/bin/sh
+#
+# Copyright (c) 2026 Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# FlashDump round trip on the FlashBench corpus
+#
+# For every corpus image: the reference is the literal/fill only stream
+# without digests, checked sector by sector against the image. Streams
+# with match search, digests of the image itself and of another corpus
+# image, and a small output buffer (-m 256) must decode to the same bytes.
+# The target Dump() built for the host (FlashPrgBuild.sh) must write the
+# same bytes as the reference encoder for the same options, in calls of the
+# whole range, one sector, 2.75 sectors and half a sector. Calls of at least
+# one sector must not change the stream.
+# The dump range is the 2M non-secure flash of the corpus.
+#
+# Usage: ./FlashDumpTest.sh [work dir]
+
+set -e
+cd "$(dirname "$0")"
+W=${1:-${TMPDIR:-/tmp}/FlashDumpTest}
+CC=${CC:-cc}
+R="-b 0x08000000 -s 0x200000"
+
+mkdir -p "$W/corpus"
+$CC -O2 -o "$W/FlashBench" FlashBench.c FlashModel.c FlmDevice.c Crc32.c Corpus.c
+$CC -O2 -o "$W/FlashDump"  FlashDump.c  Image.c
+./FlashPrgBuild.sh "$W/prg"
+"$W/FlashBench" -w "$W/corpus" > /dev/null
+
+fail=0
+for img in "$W"/corpus/*.hex; do
+  name=$(basename "$img" .hex)
+  other=$(ls "$W"/corpus/*.hex | grep -v "/$name.hex" | head -n 1)
+  ref="$W/$name.ref.bin"
+
+  "$W/FlashDump" encode $R -n "$img" "$W/$name.ref.fdmp" > /dev/null
+  if ! "$W/FlashDump" decode -g "$img" "$W/$name.ref.fdmp" "$ref" | grep -q ", 0 differ from golden"; then
+    echo "FAIL $name: reference stream"
+    fail=1
+    continue
+  fi
+
+  for opt in "" "-m 256" "-n -m 256" "-g $img" "-g $img -m 256" "-g $other" "-g $other -m 256"; do
+    gold=$(echo "$opt" | sed -n 's/.*-g \([^ ]*\).*/-g \1/p')
+    if "$W/FlashDump" encode $R $opt "$img" "$W/$name.fdmp" > /dev/null &&
+       "$W/FlashDump" decode $gold "$W/$name.fdmp" "$W/$name.bin" > /dev/null &&
+       cmp -s "$ref" "$W/$name.bin"; then
+      echo "ok   $name $opt"
+    else
+      echo "FAIL $name $opt"
+      fail=1
+    fi
+  done
+
+  # target Dump() against the reference encoder, byte by byte
+  "$W/FlashDump" digest $R "$img"   "$W/$name.dig"  > /dev/null
+  "$W/FlashDump" digest $R "$other" "$W/other.dig"  > /dev/null
+  for opt in "" "-n -m 256" "-g $other" "-g $img -m 256"; do
+    dig=$(echo "$opt" | sed -e "s|-g $img|-d $W/$name.dig|" -e "s|-g $other|-d $W/other.dig|")
+    "$W/FlashDump" encode $R $opt "$img" "$W/$name.enc.fdmp" > /dev/null
+    for call in "" "-c 0x2000" "-c 0x5800" "-c 0x1000"; do
+      if "$W/FlashDump" encode $R $opt $call "$img" "$W/$name.ref.fdmp" > /dev/null &&
+         "$W/prg/FlashPrgTest" dump $dig $call "$img" "$W/$name.tgt.fdmp" > /dev/null &&
+         cmp -s "$W/$name.ref.fdmp" "$W/$name.tgt.fdmp" &&
+         { [ "$call" = "-c 0x1000" ] || cmp -s "$W/$name.enc.fdmp" "$W/$name.tgt.fdmp"; }; then
+        echo "ok   $name target $opt $call"
+      else
+        echo "FAIL $name target $opt $call"
+        fail=1
+      fi
+    done
+  done
+done
+
+exit $fail
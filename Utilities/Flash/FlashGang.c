@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Gang programming driver
+ *
+ * Prepares the image once for all targets:
+ *  - one batch per touched sector: EraseSector, ProgramPage for every
+ *    szPage page holding data (blank pages are skipped), CrcRange check
+ *    against the CRC-32 of the sector content after the batch
+ * and drives N simulated targets (flash model) from W worker threads.
+ * Each worker owns a deque of (target, batch) items and steals from the
+ * tail of other deques when it has no runnable item. A target executes
+ * one batch at a time; items of busy targets stay queued. A worker
+ * without a runnable item waits on a condition variable until a target
+ * is released.
+ * A failed batch (call error or CRC mismatch) is retried at once with
+ * erase while the worker still holds the target. Transient failures are
+ * drawn per target, batch, attempt and page, so they do not depend on the
+ * execution order. A protection failure (FlashProtReason) is not retried.
+ * After the retry limit or protection failure the target is marked failed
+ * and its remaining items are dropped, the other targets continue.
+ * Workers sleep for the modeled duration of each batch (divided by the
+ * speed-up), so targets and workers are busy as long as with real probes
+ * and the scheduler sees realistic contention. The reported time of a
+ * target is its modeled time (scaled by -s), the same on every run; time
+ * waiting for a worker is not included, the host time is shown separately.
+ *
+ * Usage: FlashGang [-n targets] [-w workers] [-t name=value]... [-s target=factor]...
+ *                  [-x target] [-e rate] [-R retries] [-r speedup] [-b adr] image [file.FLM]
+ *   -n   number of targets (default 4)
+ *   -w   number of worker threads (default: number of targets)
+ *   -t   override timing model parameter (see FlashTiming_Parse)
+ *   -s   slow down target: all times of this target scaled by factor
+ *   -x   target with write protected flash (permanent failure)
+ *   -e   transient ProgramPage failure rate (0..1)
+ *   -R   retries per batch (default 2)
+ *   -r   simulation speed-up over target time (default 20)
+ *   -b   load address of a binary image
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FlmDevice.h"
+#include "FlashModel.h"
+#include "Image.h"
+#include "Crc32.h"
+
+#define TARGET_MAX      64U
+#define WORKER_MAX      64U
+
+typedef struct {
+  uint32_t adr;
+  uint32_t size;
+} Page_t;
+
+typedef struct {
+  uint32_t adr;                         /* Sector address */
+  uint32_t size;                        /* Sector size */
+  uint32_t page;                        /* First page */
+  uint32_t nPage;
+  uint32_t crc;                         /* CRC-32 of the sector after programming */
+} Batch_t;
+
+typedef struct {                        /* Preprocessed image, shared read-only */
+  const FlmDevice_t *dev;
+  uint8_t           *mem;               /* Sector content, valEmpty outside image */
+  Page_t            *page;
+  uint32_t           nPage;
+  Batch_t           *batch;
+  uint32_t           nBatch;
+  uint32_t           bytes;             /* Image bytes */
+} Prep_t;
+
+typedef struct {
+  uint32_t         id;
+  FlashModel_t     m;
+  pthread_mutex_t  lock;                /* One batch at a time */
+  double           clock;               /* Modeled time (s, target time) */
+  double           scale;               /* Time factor (slow probe) */
+  double           failRate;            /* Transient failure rate */
+  uint32_t         seed;                /* Transient failures of this target */
+  uint32_t         open;                /* Init done */
+  uint32_t         done;                /* Completed batches */
+  uint32_t         retries;
+  uint32_t         failed;              /* Target given up */
+  uint32_t         failAdr;             /* Failed sector, else lowest retried sector */
+} Target_t;
+
+typedef struct {
+  uint32_t target;
+  uint32_t batch;
+} Item_t;
+
+typedef struct {
+  pthread_mutex_t  lock;
+  Item_t          *item;                /* Ring of 'cap' items */
+  uint32_t         cap;
+  uint32_t         head;
+  uint32_t         tail;
+} Deque_t;
+
+typedef struct {
+  uint32_t         id;
+  Deque_t          dq;
+  uint32_t         items;               /* Executed batches */
+  uint32_t         steals;
+} Worker_t;
+
+static const Prep_t *Prep;
+static Target_t      Target[TARGET_MAX];
+static Worker_t      Worker[WORKER_MAX];
+static uint32_t      nTarget = 4U, nWorker = 0U, maxRetry = 2U;
+static uint32_t      Pending;           /* Items not finished */
+static uint32_t      Epoch;             /* Target releases, wakes waiting workers */
+static double        Speedup = 20.0;
+static pthread_mutex_t SchedLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  SchedCond = PTHREAD_COND_INITIALIZER;
+
+static const char *ProtName[] = { "", "WRP", "HDP", "SECWM", "EDATA" };
+
+
+static double Now (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec + ((double)ts.tv_nsec * 1.0e-9));
+}
+
+static void Sleep (double t) {
+  struct timespec ts;
+
+  ts.tv_sec  = (time_t)t;
+  ts.tv_nsec = (long)((t - (double)ts.tv_sec) * 1.0e9);
+  (void)nanosleep(&ts, NULL);
+}
+
+static int Push (Deque_t *d, Item_t it) {
+  int ret = 0;
+
+  pthread_mutex_lock(&d->lock);
+  if ((d->tail - d->head) < d->cap) {
+    d->item[d->tail++ % d->cap] = it;
+  } else {
+    ret = 1;
+  }
+  pthread_mutex_unlock(&d->lock);
+  return (ret);
+}
+
+/* Owner takes from head, thieves from tail */
+static int Pop (Deque_t *d, Item_t *it, int steal) {
+  int ret = 1;
+
+  pthread_mutex_lock(&d->lock);
+  if (d->tail != d->head) {
+    *it = steal ? d->item[--d->tail % d->cap] : d->item[d->head++ % d->cap];
+    ret = 0;
+  }
+  pthread_mutex_unlock(&d->lock);
+  return (ret);
+}
+
+static uint32_t Count (Deque_t *d) {
+  uint32_t n;
+
+  pthread_mutex_lock(&d->lock);
+  n = d->tail - d->head;
+  pthread_mutex_unlock(&d->lock);
+  return (n);
+}
+
+/* Item finished and its target released: wake waiting workers */
+static void Finish (void) {
+  pthread_mutex_lock(&SchedLock);
+  Pending--;
+  Epoch++;
+  pthread_cond_broadcast(&SchedCond);
+  pthread_mutex_unlock(&SchedLock);
+}
+
+/* Take an item whose target is free, own deque first, then steal;
+   items of busy targets stay queued
+     Return Value: 0 - OK (target locked), 1 - nothing runnable */
+static int Take (Worker_t *w, Item_t *it, uint32_t *stolen) {
+  Deque_t *d;
+  uint32_t i, n;
+
+  n = Count(&w->dq);
+  for (i = 0U; (i < n) && (Pop(&w->dq, it, 0) == 0); i++) {
+    if (pthread_mutex_trylock(&Target[it->target].lock) == 0) {
+      *stolen = 0U;
+      return (0);
+    }
+    (void)Push(&w->dq, *it);                            /* target busy, back of own deque */
+  }
+  for (i = 1U; i < nWorker; i++) {
+    d = &Worker[(w->id + i) % nWorker].dq;
+    if (Pop(d, it, 1) != 0) {
+      continue;
+    }
+    if (pthread_mutex_trylock(&Target[it->target].lock) == 0) {
+      *stolen = 1U;
+      return (0);
+    }
+    (void)Push(d, *it);                                 /* back to the tail it came from */
+  }
+  return (1);
+}
+
+/* Hash of target seed, batch, attempt and page for transient failures */
+static uint32_t Mix (uint32_t seed, uint32_t batch, uint32_t try, uint32_t page) {
+  uint32_t h = seed;
+
+  h = (h ^ batch) * 0x9E3779B1U;
+  h = (h ^ (h >> 15) ^ try) * 0x85EBCA77U;
+  h = (h ^ (h >> 13) ^ page) * 0xC2B2AE3DU;
+  return (h ^ (h >> 16));
+}
+
+/* Erase, program and check one sector, return 0 - OK, 1 - Failed */
+static int RunBatch (Target_t *t, uint32_t batch, uint32_t try) {
+  const FlmDevice_t *dev = Prep->dev;
+  const Batch_t     *b   = &Prep->batch[batch];
+  uint32_t i, crc = 0U;
+  int      ret;
+
+  ret = FlashModel_EraseSector(&t->m, b->adr);
+  for (i = b->page; (i < (b->page + b->nPage)) && (ret == 0); i++) {
+    const Page_t *p = &Prep->page[i];
+
+    if ((t->failRate > 0.0) &&
+        ((double)(Mix(t->seed, batch, try, i) >> 8) < (t->failRate * (double)(1U << 24)))) {
+      t->m.time += t->m.timing.tCall;                   /* transient: call lost, no flash change */
+      ret = 1;
+      break;
+    }
+    ret = FlashModel_ProgramPage(&t->m, p->adr, p->size, &Prep->mem[p->adr - dev->devAdr]);
+  }
+  if (ret == 0) {
+    ret = FlashModel_CrcRange(&t->m, b->adr, b->size, &crc);
+  }
+  if ((ret == 0) && (crc != b->crc)) {
+    ret = 1;
+  }
+  return (ret);
+}
+
+static void *WorkerThread (void *arg) {
+  Worker_t *w = arg;
+  Target_t *t;
+  Item_t    it = { 0U, 0U };
+  uint32_t  epoch, left, tries, stolen = 0U;
+  double    t0;
+
+  for (;;) {
+    pthread_mutex_lock(&SchedLock);
+    epoch = Epoch;
+    left  = Pending;
+    pthread_mutex_unlock(&SchedLock);
+    if (left == 0U) {
+      break;
+    }
+    if (Take(w, &it, &stolen) != 0) {                   /* wait for a target release */
+      pthread_mutex_lock(&SchedLock);
+      while ((Epoch == epoch) && (Pending != 0U)) {
+        pthread_cond_wait(&SchedCond, &SchedLock);
+      }
+      pthread_mutex_unlock(&SchedLock);
+      continue;
+    }
+
+    t = &Target[it.target];
+    if (t->failed == 0U) {                              /* else dropped */
+      t0 = t->m.time;
+      if (t->open == 0U) {
+        (void)FlashModel_Init(&t->m, Prep->dev->devAdr, 0U, 2U);
+        t->open = 1U;
+      }
+      for (tries = 0U; ; tries++) {                     /* retry at once: erase and program again */
+        if (RunBatch(t, it.batch, tries) == 0) {
+          t->done++;
+          break;
+        }
+        if ((t->m.protReason != FLASH_PROT_NONE) || (tries == maxRetry)) {
+          t->failed  = 1U;                              /* protection: a retry cannot help */
+          t->failAdr = Prep->batch[it.batch].adr;
+          break;
+        }
+        if ((t->retries == 0U) || (Prep->batch[it.batch].adr < t->failAdr)) {
+          t->failAdr = Prep->batch[it.batch].adr;       /* independent of the batch order */
+        }
+        t->retries++;
+      }
+      if ((t->open != 0U) && ((t->failed != 0U) || (t->done == Prep->nBatch))) {
+        (void)FlashModel_UnInit(&t->m, 2U);
+        t->open = 0U;
+      }
+
+      Sleep(((t->m.time - t0) * t->scale) / Speedup);   /* target and worker busy */
+      t->clock = t->m.time * t->scale;
+      w->items++;
+      w->steals += stolen;                              /* executed stolen items */
+    }
+    pthread_mutex_unlock(&t->lock);
+    Finish();
+  }
+  return (NULL);
+}
+
+/* Preprocess image: pages and sector batches with CRC */
+static int Prepare (Prep_t *p, const FlmDevice_t *dev, const Image_t *img) {
+  uint8_t *used;
+  uint32_t i, j, ofs, adr, sz, pg, blank, alias = 0x04000000U;
+
+  memset(p, 0, sizeof(*p));
+  p->dev = dev;
+  p->mem = malloc(dev->szDev);
+  used   = calloc(dev->szDev, 1U);
+  p->page  = malloc(((dev->szDev / dev->szPage) + 1U) * sizeof(Page_t));
+  p->batch = malloc((FlmDevice_SectorCount(dev) + 1U) * sizeof(Batch_t));
+  if ((p->mem == NULL) || (used == NULL) || (p->page == NULL) || (p->batch == NULL)) {
+    free(used);
+    return (1);
+  }
+  memset(p->mem, dev->valEmpty, dev->szDev);
+
+  for (i = 0U; i < img->nSeg; i++) {                    /* image for the other alias is relocated */
+    if ((img->seg[i].adr < ((uint64_t)dev->devAdr + dev->szDev)) &&
+        (((uint64_t)img->seg[i].adr + img->seg[i].size) > dev->devAdr)) {
+      alias = 0U;
+    }
+  }
+  for (i = 0U; i < img->nSeg; i++) {
+    for (j = 0U; j < img->seg[i].size; j++) {
+      ofs = ((img->seg[i].adr + j) ^ alias) - dev->devAdr;
+      if (ofs < dev->szDev) {
+        p->mem[ofs] = img->seg[i].data[j];
+        used[ofs]   = 1U;
+        p->bytes++;
+      }
+    }
+  }
+
+  for (adr = dev->devAdr; (adr - dev->devAdr) < dev->szDev; adr += sz) {
+    adr = FlmDevice_Sector(dev, adr, &sz);
+    if (sz == 0U) {
+      break;
+    }
+    ofs = adr - dev->devAdr;
+    for (j = 0U; (j < sz) && (used[ofs + j] == 0U); j++);
+    if (j == sz) {
+      continue;                                         /* untouched sector */
+    }
+    Batch_t *b = &p->batch[p->nBatch++];
+    b->adr   = adr;
+    b->size  = sz;
+    b->page  = p->nPage;
+    b->nPage = 0U;
+    b->crc   = Crc32(0U, &p->mem[ofs], sz);
+    for (pg = 0U; pg < sz; pg += dev->szPage) {
+      for (j = 0U, blank = 1U; (j < dev->szPage) && ((pg + j) < sz); j++) {
+        if (p->mem[ofs + pg + j] != dev->valEmpty) {
+          blank = 0U;
+        }
+      }
+      if (blank != 0U) {
+        continue;                                       /* erased already */
+      }
+      Page_t *q = &p->page[p->nPage++];
+      q->adr  = adr + pg;
+      q->size = ((sz - pg) < dev->szPage) ? (sz - pg) : dev->szPage;
+      b->nPage++;
+    }
+  }
+  free(used);
+  return (0);
+}
+
+int main (int argc, char *argv[]) {
+  FlashTiming_t timing = FlashTiming_Default;
+  FlmDevice_t  *dev;
+  Image_t       img;
+  Prep_t        prep;
+  pthread_t     thr[WORKER_MAX];
+  const char   *imgPath = NULL, *flmPath = NULL;
+  uint32_t      binAdr = 0U, binSet = 0U, i, j, k, nOk = 0U, steals = 0U, nThread;
+  uint32_t      slow[TARGET_MAX] = { 0U }, wp[TARGET_MAX] = { 0U };
+  double        factor[TARGET_MAX], failRate = 0.0, makespan = 0.0, wall, tPrep;
+  char         *end;
+  int           a, ret = 0;
+
+  for (a = 1; a < argc; a++) {
+    if ((strcmp(argv[a], "-n") == 0) && ((a + 1) < argc)) {
+      nTarget = (uint32_t)strtoul(argv[++a], NULL, 0);
+    } else if ((strcmp(argv[a], "-w") == 0) && ((a + 1) < argc)) {
+      nWorker = (uint32_t)strtoul(argv[++a], NULL, 0);
+    } else if ((strcmp(argv[a], "-t") == 0) && ((a + 1) < argc)) {
+      if (FlashTiming_Parse(&timing, argv[++a]) != 0) {
+        fprintf(stderr, "Invalid timing parameter: %s\n", argv[a]);
+        return (2);
+      }
+    } else if ((strcmp(argv[a], "-s") == 0) && ((a + 1) < argc)) {
+      k = (uint32_t)strtoul(argv[++a], &end, 0);
+      if ((*end != '=') || (k >= TARGET_MAX) || ((factor[k] = strtod(end + 1, NULL)) <= 0.0)) {
+        fprintf(stderr, "Invalid slow down: %s\n", argv[a]);
+        return (2);
+      }
+      slow[k] = 1U;
+    } else if ((strcmp(argv[a], "-x") == 0) && ((a + 1) < argc)) {
+      k = (uint32_t)strtoul(argv[++a], NULL, 0);
+      if (k < TARGET_MAX) {
+        wp[k] = 1U;
+      }
+    } else if ((strcmp(argv[a], "-e") == 0) && ((a + 1) < argc)) {
+      failRate = strtod(argv[++a], NULL);
+    } else if ((strcmp(argv[a], "-R") == 0) && ((a + 1) < argc)) {
+      maxRetry = (uint32_t)strtoul(argv[++a], NULL, 0);
+    } else if ((strcmp(argv[a], "-r") == 0) && ((a + 1) < argc)) {
+      Speedup = strtod(argv[++a], NULL);
+    } else if ((strcmp(argv[a], "-b") == 0) && ((a + 1) < argc)) {
+      binAdr = (uint32_t)strtoul(argv[++a], NULL, 0);
+      binSet = 1U;
+    } else if ((argv[a][0] != '-') && (imgPath == NULL)) {
+      imgPath = argv[a];
+    } else if ((argv[a][0] != '-') && (flmPath == NULL)) {
+      flmPath = argv[a];
+    } else {
+      imgPath = NULL;
+      break;
+    }
+  }
+  if (nWorker == 0U) {
+    nWorker = nTarget;
+  }
+  if ((imgPath == NULL) || (nTarget == 0U) || (nTarget > TARGET_MAX) || (nWorker > WORKER_MAX) ||
+      (failRate < 0.0) || (failRate > 1.0) || (Speedup <= 0.0)) {
+    fprintf(stderr, "Usage: %s [-n targets] [-w workers] [-t name=value]... [-s target=factor]...\n"
+                    "       [-x target] [-e rate] [-R retries] [-r speedup] [-b adr] image [file.FLM]\n", argv[0]);
+    return (2);
+  }
+
+  dev = malloc(sizeof(*dev));
+  if (dev == NULL) {
+    return (1);
+  }
+  if (flmPath == NULL) {
+    FlmDevice_Default(dev, 0x08000000U, 0x00200000U);
+  } else if (FlmDevice_Load(flmPath, dev) != 0) {
+    fprintf(stderr, "Cannot read FlashDevice from %s\n", flmPath);
+    free(dev);
+    return (1);
+  }
+  if (Image_Load(&img, imgPath, (binSet != 0U) ? binAdr : dev->devAdr) != 0) {
+    fprintf(stderr, "Cannot read image %s\n", imgPath);
+    free(dev);
+    return (1);
+  }
+
+  /* Preprocess once for all targets */
+  tPrep = Now();
+  if (Prepare(&prep, dev, &img) != 0) {
+    fprintf(stderr, "Out of memory\n");
+    ret = 1;
+    goto exit;
+  }
+  tPrep = Now() - tPrep;
+  Prep  = &prep;
+
+  for (i = 0U; i < nTarget; i++) {
+    Target_t *t = &Target[i];
+
+    t->id       = i;
+    t->scale    = (slow[i] != 0U) ? factor[i] : 1.0;
+    t->failRate = failRate;
+    t->seed     = 0x2545F491U + i;
+    pthread_mutex_init(&t->lock, NULL);
+    if (FlashModel_Create(&t->m, dev, &timing, (uint8_t)~dev->valEmpty) != 0) {
+      ret = 1;
+      goto exit;
+    }
+    if (wp[i] != 0U) {                                  /* permanent: first sector write protected */
+      FlashModel_Protect(&t->m, (prep.nBatch != 0U) ? prep.batch[0].adr : dev->devAdr, 1U, FLASH_PROT_WRP);
+    }
+  }
+
+  /* Items of target i start in the deque of worker i % nWorker */
+  for (i = 0U; i < nWorker; i++) {
+    Worker_t *w = &Worker[i];
+
+    w->id     = i;
+    w->dq.cap  = (nTarget * prep.nBatch) + 1U;          /* any deque may hold all items */
+    w->dq.item = malloc(w->dq.cap * sizeof(Item_t));
+    pthread_mutex_init(&w->dq.lock, NULL);
+    if (w->dq.item == NULL) {
+      ret = 1;
+      goto exit;
+    }
+  }
+  for (j = 0U; j < prep.nBatch; j++) {                  /* interleave targets in each deque */
+    for (i = 0U; i < nTarget; i++) {
+      Item_t it = { i, j };
+
+      (void)Push(&Worker[i % nWorker].dq, it);
+      Pending++;
+    }
+  }
+
+  wall = Now();
+  for (nThread = 0U; nThread < nWorker; nThread++) {
+    if (pthread_create(&thr[nThread], NULL, WorkerThread, &Worker[nThread]) != 0) {
+      break;                                            /* deques of missing workers are stolen from */
+    }
+  }
+  if (nThread < nWorker) {
+    fprintf(stderr, "Warning: only %u of %u worker threads started\n", (unsigned int)nThread, (unsigned int)nWorker);
+  }
+  if (nThread == 0U) {
+    ret = 1;
+    goto exit;
+  }
+  for (i = 0U; i < nThread; i++) {
+    pthread_join(thr[i], NULL);
+  }
+  wall = Now() - wall;
+
+  printf("Image:   %s, %u bytes, %u sector batches, %u pages, prepared in %.3f ms\n", imgPath,
+         (unsigned int)prep.bytes, (unsigned int)prep.nBatch, (unsigned int)prep.nPage, tPrep * 1000.0);
+  printf("Device:  %s, %u targets, %u workers\n", dev->devName, (unsigned int)nTarget, (unsigned int)nThread);
+  printf("%6s %-7s %9s %6s %6s %7s %9s %9s %-10s\n",
+         "target", "status", "bytes", "erase", "pages", "retries", "time s", "bytes/s", "failed at");
+  for (i = 0U; i < nTarget; i++) {
+    Target_t *t  = &Target[i];
+    uint32_t  ok = ((t->failed == 0U) && (t->done == prep.nBatch)) ? 1U : 0U;
+
+    nOk += ok;
+    if (t->clock > makespan) {
+      makespan = t->clock;
+    }
+    printf("%6u %-7s %9u %6u %6u %7u %9.3f %9.0f ", (unsigned int)i, (ok != 0U) ? "OK" : "FAILED",
+           (unsigned int)((ok != 0U) ? prep.bytes : 0U), (unsigned int)t->m.nErase,
+           (unsigned int)t->m.nProgram, (unsigned int)t->retries, t->clock,
+           ((ok != 0U) && (t->clock > 0.0)) ? ((double)prep.bytes / t->clock) : 0.0);
+    if ((t->retries != 0U) || (t->failed != 0U)) {
+      printf("0x%08X", (unsigned int)t->failAdr);
+    }
+    if (t->m.protReason < (sizeof(ProtName) / sizeof(ProtName[0]))) {
+      printf(" %s", ProtName[t->m.protReason]);         /* FlashProtReason */
+    }
+    printf("\n");
+    if (ok == 0U) {
+      ret = 1;
+    }
+  }
+  for (i = 0U; i < nWorker; i++) {
+    steals += Worker[i].steals;
+  }
+  printf("Total:   %u of %u targets OK, %u bytes in %.3f s (%.0f bytes/s), %u steals, host %.3f s\n",
+         (unsigned int)nOk, (unsigned int)nTarget, (unsigned int)(nOk * prep.bytes), makespan,
+         (makespan > 0.0) ? ((double)(nOk * prep.bytes) / makespan) : 0.0, (unsigned int)steals, wall);
+
+exit:
+  for (i = 0U; i < nTarget; i++) {
+    FlashModel_Destroy(&Target[i].m);
+  }
+  for (i = 0U; i < nWorker; i++) {
+    free(Worker[i].dq.item);
+  }
+  free(prep.mem);
+  free(prep.page);
+  free(prep.batch);
+  Image_Free(&img);
+  free(dev);
+  return (ret);
+}
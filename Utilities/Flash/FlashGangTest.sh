@@ -0,0 +1,91 @@
+#!/bin/sh
+#
+# Copyright (c) 2026 Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# FlashGang on the FlashBench corpus
+#
+# Each case runs FlashGang on the code image and checks the exit status
+# and every target row (status, erase and page counts, retries, failed
+# sector, FlashProtReason) against an awk condition on the table fields.
+# Covers a write protected target (-x), transient ProgramPage failures
+# (-e) with retries, a retry limit that gives up (-e 1) and a slow target
+# (-s). The target rows do not depend on the number of workers, so the
+# reported modeled times are compared between -w 4, 2 and 1.
+#
+# Usage: ./FlashGangTest.sh [work dir]
+
+set -e
+cd "$(dirname "$0")"
+W=${1:-${TMPDIR:-/tmp}/FlashGangTest}
+CC=${CC:-cc}
+C=$W/corpus
+
+mkdir -p "$C"
+$CC -O2 -o "$W/FlashBench" FlashBench.c FlashModel.c FlmDevice.c Crc32.c Corpus.c
+$CC -O2 -pthread -o "$W/FlashGang" FlashGang.c FlashModel.c FlmDevice.c Crc32.c Image.c
+"$W/FlashBench" -w "$C" > /dev/null
+
+fail=0
+# target rows: target status bytes erase pages retries time bytes/s [failed at] [reason]
+rows() {
+  echo "$1" | awk '$1 ~ /^[0-9]+$/ && NF >= 8'
+}
+
+# case: options | exit status | number of targets | awk condition for each target row
+check() {
+  rc=0
+  out=$("$W/FlashGang" -r 1000 $1 "$C/code_2048K.hex") || rc=$?
+  bad=$(rows "$out" | awk "!($4) { n++ } END { print n + 0 }")
+  if [ $rc -eq $2 ] && [ "$(rows "$out" | wc -l)" -eq $3 ] && [ "$bad" -eq 0 ]; then
+    echo "ok   $1"
+  else
+    echo "FAIL $1: exit status $rc"
+    rows "$out"
+    fail=1
+  fi
+}
+
+check "-n 4"               0 4 '$2 == "OK" && $3 == 393216 && $4 == 48 && $5 == 384 && $6 == 0 && NF == 8'
+check "-n 4 -w 1"          0 4 '$2 == "OK" && $4 == 48 && $5 == 384 && $6 == 0'
+check "-n 4 -x 1"          1 4 '($1 == 1) ? ($2 == "FAILED" && $4 == 0 && $5 == 0 && $6 == 0 && $9 == "0x08000000" && $10 == "WRP") : ($2 == "OK" && $6 == 0)'
+check "-n 4 -x 1 -e 0.01"  1 4 '($1 == 1) ? ($2 == "FAILED" && $10 == "WRP") : ($2 == "OK" && $6 > 0 && $4 == 48 + $6 && NF == 9)'
+check "-n 3 -e 1 -R 2"     1 3 '$2 == "FAILED" && $3 == 0 && $4 == 3 && $5 == 0 && $6 == 2 && NF == 9'
+check "-n 2 -e 1 -R 0"     1 2 '$2 == "FAILED" && $4 == 1 && $6 == 0'
+
+# modeled times: same rows for any number of workers
+ref=$(rows "$("$W/FlashGang" -r 1000 -n 4 -w 4 -x 1 -e 0.01 "$C/code_2048K.hex" || true)")
+for w in 2 1; do
+  cur=$(rows "$("$W/FlashGang" -r 1000 -n 4 -w $w -x 1 -e 0.01 "$C/code_2048K.hex" || true)")
+  if [ "$cur" = "$ref" ]; then
+    echo "ok   -n 4 -w $w -x 1 -e 0.01: rows as with -w 4"
+  else
+    echo "FAIL -n 4 -w $w -x 1 -e 0.01: rows differ from -w 4"
+    fail=1
+  fi
+done
+
+# slow target: three times the modeled time of the others
+out=$("$W/FlashGang" -r 1000 -n 2 -s 1=3 "$C/code_2048K.hex")
+if rows "$out" | awk '{ t[$1] = $7 } END { exit !((t[0] > 0) && (t[1] == sprintf("%.3f", 3 * t[0]))) }'; then
+  echo "ok   -n 2 -s 1=3"
+else
+  echo "FAIL -n 2 -s 1=3"
+  rows "$out"
+  fail=1
+fi
+
+exit $fail
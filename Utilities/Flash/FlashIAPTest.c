@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Flash IAP host test
+ *
+ * Runs CMSIS/Flash/STM32H5xx/IAP/FlashIAP.c (built with FLASH_HOST, see
+ * FlashIAPTest.sh) against a mocked register block. The flash, the FLASH
+ * and ICACHE registers and the flash size word are mapped at their device
+ * addresses. Step() plays the flash controller: it performs the sector
+ * erase selected by FLASH_NSCR (BKSEL is the physical bank), sets EOP or
+ * an injected error and calls FlashIAP_IRQHandler.
+ *
+ * Usage: FlashIAPTest run
+ *          queue, bank selection with and without SWAP_BANK, error
+ *          completion, cache invalidation, one line per case
+ *   exit status 0 - OK, 1 - failed, 2 - usage or memory map
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* Target instructions for the host build */
+#define DSB()           __sync_synchronize()
+#define IrqLock()       (0U)
+#define IrqUnlock(p)    ((void)(p))
+#define FLASH_IAP_RAMFUNC
+
+#include "IAP/FlashIAP.c"
+
+#define DEV_BASE        0x08000000U     /* non-secure flash */
+#define DEV_SIZE        0x00200000U     /* STM32H5xx_2048 */
+#define BANK_SIZE       (DEV_SIZE / 2U)
+#define SECT_SIZE       0x2000U
+
+#define EVENT_MAX       32U
+
+/* Completion log of the callbacks */
+static struct {
+  uint32_t event;
+  uint32_t adr;
+  uint32_t inv;                         /* ICACHE invalidated before the callback */
+} Event[EVENT_MAX];
+static uint32_t nEvent;
+
+/* Erases seen by the controller: physical bank and sector */
+static uint32_t EraseBank[EVENT_MAX], EraseSect[EVENT_MAX], nErase;
+
+static void Callback (uint32_t event, uint32_t adr, void *arg) {
+  (void)arg;
+  if (nEvent < EVENT_MAX) {
+    Event[nEvent].event = event;
+    Event[nEvent].adr   = adr;
+    Event[nEvent].inv   = ((ICACHE->CR & ICACHE_CR_CACHEINV) != 0U) ? 1U : 0U;
+    nEvent++;
+  }
+}
+
+/* Map anonymous host memory at a device address */
+static int Map (uint32_t adr, uint32_t size) {
+  void *p;
+  int   flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#ifdef MAP_FIXED_NOREPLACE
+  flags |= MAP_FIXED_NOREPLACE;
+#endif
+  p = mmap((void *)(uintptr_t)adr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+  if (p != (void *)(uintptr_t)adr) {
+    fprintf(stderr, "Cannot map 0x%08X..0x%08X\n", (unsigned int)adr, (unsigned int)(adr + size - 1U));
+    return (1);
+  }
+  return (0);
+}
+
+/* Flash, registers, flash size word */
+static int MapDevice (void) {
+  return (Map(DEV_BASE, DEV_SIZE) ||
+          Map(FLASHSIZE_BASE & ~0xFFFU, 0x1000U) ||
+          Map(FLASH_BASE     & ~0xFFFU, 0x1000U) ||
+          Map(ICACHE_BASE    & ~0xFFFU, 0x1000U));
+}
+
+/* Registers after reset with the cache enabled, flash filled with 0x00 */
+static void ResetDevice (uint32_t swap) {
+  memset((void *)FLASH, 0, sizeof(FLASH_TypeDef));
+  memset((void *)(uintptr_t)DEV_BASE, 0x00, DEV_SIZE);
+  M32(FLASHSIZE_BASE) = DEV_SIZE >> 10;
+  FLASH->OPTSR_CUR    = (swap != 0U) ? FLASH_OPTSR_SWAP_BANK : 0U;
+  ICACHE->CR          = ICACHE_CR_EN;
+  ICACHE->SR          = 0U;
+  nEvent = 0U;
+  nErase = 0U;
+}
+
+/* Controller: complete the started step, err: error flag to report
+     Return Value: 0 - step completed, 1 - nothing started */
+static int Step (uint32_t err) {
+  uint32_t cr = FLASH->NSCR, bank, sect, adr;
+
+  if ((cr & (FLASH_CR_SER | FLASH_CR_STRT)) == (FLASH_CR_SER | FLASH_CR_STRT)) {
+    bank = cr >> 31;
+    sect = (cr & FLASH_CR_PNB_MSK) >> 6;
+    if (nErase < EVENT_MAX) {
+      EraseBank[nErase] = bank;
+      EraseSect[nErase] = sect;
+      nErase++;
+    }
+    adr = DEV_BASE + ((bank ^ ((FLASH->OPTSR_CUR >> 31) & 1U)) * BANK_SIZE) + (sect * SECT_SIZE);
+    if (err == 0U) {
+      memset((void *)(uintptr_t)adr, 0xFF, SECT_SIZE);
+    }
+  } else if ((cr & FLASH_CR_PG) == 0U) {
+    return (1);                                         /* quad-word already in memory when PG set */
+  }
+  ICACHE->CR &= ~ICACHE_CR_CACHEINV;
+  FLASH->NSSR = (err != 0U) ? err : FLASH_SR_EOP;
+  FlashIAP_IRQHandler();
+  FLASH->NSSR = 0U;                                     /* NSCCR is write-1-to-clear on the device */
+  return (0);
+}
+
+/* Run the controller until idle, error on step errStep (0: none) */
+static void Run (uint32_t errStep) {
+  uint32_t n;
+
+  for (n = 1U; (FlashIAP_Pending() != 0U) && (n < 10000U); n++) {
+    if (Step((n == errStep) ? FLASH_SR_WRPERR : 0U) != 0) {
+      break;
+    }
+  }
+}
+
+static int Check (const char *name, int ok) {
+  printf("%s %s\n", ok ? "ok  " : "FAIL", name);
+  return (ok ? 0 : 1);
+}
+
+static int CmdRun (void) {
+  static uint8_t data[64];
+  uint32_t i;
+  int      fail = 0, ok;
+
+  for (i = 0U; i < sizeof(data); i++) {
+    data[i] = (uint8_t)(0xA5U ^ (i * 7U));
+  }
+
+  /* Erase and program in bank 2, then bank 1 */
+  ResetDevice(0U);
+  ok = (FlashIAP_Initialize() == FLASH_IAP_OK) &&
+       (FlashIAP_EraseSector(0x08102010U, Callback, NULL) == FLASH_IAP_OK) &&
+       (FlashIAP_Program(0x08102000U, data, sizeof(data), Callback, NULL) == FLASH_IAP_OK) &&
+       (FlashIAP_EraseSector(0x08004000U, Callback, NULL) == FLASH_IAP_OK) &&
+       (FlashIAP_ActiveBank() == 1) && (FlashIAP_Pending() == 3U);
+  Run(0U);
+  ok = ok && (nEvent == 3U) && (nErase == 2U) &&
+       (EraseBank[0] == 1U) && (EraseSect[0] == 1U) && (EraseBank[1] == 0U) && (EraseSect[1] == 2U) &&
+       (Event[0].event == FLASH_IAP_EVENT_DONE) && (Event[0].adr == 0x08102000U) &&
+       (Event[1].event == FLASH_IAP_EVENT_DONE) && (Event[1].adr == 0x08102000U) &&
+       (Event[2].event == FLASH_IAP_EVENT_DONE) && (Event[2].adr == 0x08004000U) &&
+       (memcmp((void *)0x08102000U, data, sizeof(data)) == 0) &&
+       (M32(0x08102000U + sizeof(data)) == 0xFFFFFFFFU) && (M32(0x08004000U) == 0xFFFFFFFFU) &&
+       (FlashIAP_ActiveBank() == -1);
+  fail |= Check("erase, program, erase", ok);
+
+  ok = (nEvent == 3U) && (Event[0].inv != 0U) && (Event[1].inv != 0U) && (Event[2].inv != 0U);
+  fail |= Check("ICACHE invalidated before each callback", ok);
+
+  ResetDevice(0U);
+  ICACHE->CR = 0U;
+  ok = (FlashIAP_Initialize() == FLASH_IAP_OK) &&
+       (FlashIAP_EraseSector(0x08000000U, Callback, NULL) == FLASH_IAP_OK);
+  Run(0U);
+  ok = ok && (nEvent == 1U) && (Event[0].inv == 0U);
+  fail |= Check("ICACHE disabled, not touched", ok);
+
+  /* SWAP_BANK: the lower half is bank 2 */
+  ResetDevice(1U);
+  ok = (FlashIAP_Initialize() == FLASH_IAP_OK) &&
+       (FlashIAP_EraseSector(0x08002000U, Callback, NULL) == FLASH_IAP_OK) &&
+       (FlashIAP_ActiveBank() == 1);
+  Run(0U);
+  ok = ok && (nErase == 1U) && (EraseBank[0] == 1U) && (EraseSect[0] == 1U) &&
+       (M32(0x08002000U) == 0xFFFFFFFFU) && (M32(0x08102000U) == 0U);
+  fail |= Check("SWAP_BANK, erase lower half selects bank 2", ok);
+
+  ok = (FlashIAP_EraseSector(0x08100000U, Callback, NULL) == FLASH_IAP_OK) &&
+       (FlashIAP_ActiveBank() == 0);
+  Run(0U);
+  ok = ok && (nErase == 2U) && (EraseBank[1] == 0U) && (EraseSect[1] == 0U) &&
+       (M32(0x08100000U) == 0xFFFFFFFFU) && (M32(0x08000000U) == 0U);
+  fail |= Check("SWAP_BANK, erase upper half selects bank 1", ok);
+
+  /* Error completes the request, the next one still runs */
+  ResetDevice(0U);
+  ok = (FlashIAP_Initialize() == FLASH_IAP_OK) &&
+       (FlashIAP_Program(0x08000000U, data, sizeof(data), Callback, NULL) == FLASH_IAP_OK) &&
+       (FlashIAP_EraseSector(0x08006000U, Callback, NULL) == FLASH_IAP_OK);
+  Run(2U);                                              /* second quad-word fails */
+  ok = ok && (nEvent == 2U) &&
+       (Event[0].event == FLASH_IAP_EVENT_ERROR) && (Event[0].adr == 0x08000000U) && (Event[0].inv != 0U) &&
+       (Event[1].event == FLASH_IAP_EVENT_DONE)  && (Event[1].adr == 0x08006000U) &&
+       (M32(0x08006000U) == 0xFFFFFFFFU);
+  fail |= Check("error completion, queue continues", ok);
+
+  /* Queue full and parameter checks */
+  ResetDevice(0U);
+  ok = (FlashIAP_Initialize() == FLASH_IAP_OK);
+  for (i = 0U; i < FLASH_IAP_QUEUE_SIZE; i++) {
+    ok = ok && (FlashIAP_EraseSector(DEV_BASE + (i * SECT_SIZE), Callback, NULL) == FLASH_IAP_OK);
+  }
+  ok = ok && (FlashIAP_EraseSector(DEV_BASE, Callback, NULL) == FLASH_IAP_ERROR_BUSY) &&
+       (FlashIAP_Program(0x08000008U, data, 16U, Callback, NULL) == FLASH_IAP_ERROR_PARAMETER) &&
+       (FlashIAP_Program(DEV_BASE + DEV_SIZE - 16U, data, 32U, Callback, NULL) == FLASH_IAP_ERROR_PARAMETER) &&
+       (FlashIAP_EraseSector(DEV_BASE + DEV_SIZE, Callback, NULL) == FLASH_IAP_ERROR_PARAMETER);
+  Run(0U);
+  ok = ok && (nEvent == FLASH_IAP_QUEUE_SIZE) && (FlashIAP_Uninitialize() == FLASH_IAP_OK) &&
+       (FLASH->NSCR == FLASH_CR_LOCK);
+  fail |= Check("queue full, parameters, uninitialize", ok);
+
+  return (fail);
+}
+
+int main (int argc, char *argv[]) {
+  if ((argc != 2) || (strcmp(argv[1], "run") != 0)) {
+    fprintf(stderr, "Usage: %s run\n", argv[0]);
+    return (2);
+  }
+  if (MapDevice() != 0) {
+    return (2);
+  }
+  return (CmdRun());
+}
@@ -0,0 +1,43 @@
+#!/bin/sh
+#
+# Copyright (c) 2026 Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Flash IAP host test
+#
+# Builds CMSIS/Flash/STM32H5xx/IAP/FlashIAP.c for the host (FLASH_HOST,
+# non-secure) into FlashIAPTest and runs it against the mocked register
+# block: request queue, bank selection with SWAP_BANK, error completion
+# and instruction cache invalidation before the callbacks.
+#
+# Usage: ./FlashIAPTest.sh [work dir]
+
+set -e
+cd "$(dirname "$0")"
+W=${1:-${TMPDIR:-/tmp}/FlashIAPTest}
+CC=${CC:-cc}
+S=../../CMSIS/Flash/STM32H5xx
+
+# device sources with CRLF line ends
+mkdir -p "$W/src/IAP"
+for f in $S/*.h $S/IAP/*.[ch]; do
+  sed 's/\r$//' "$f" > "$W/src/${f#$S/}"
+done
+$CC -O2 -Wall -Wextra -Wno-int-to-pointer-cast -DFLASH_HOST \
+    -I"$W/src" -o "$W/FlashIAPTest" FlashIAPTest.c
+
+"$W/FlashIAPTest" run
@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Modeled STM32H5 flash controller
+ *
+ * Behaves like FlashPrg.c on real hardware:
+ *  - program granularity is one quad-word (16 bytes), a quad-word can
+ *    only be programmed once after erase (ECC), also with erased-value
+ *    data: programmed quad-words are tracked in a bitmap, not by content
+ *  - sectors marked protected fail immediately without flash time
+ * Time is accumulated per call from the timing model and compared
+ * against the toProg/toErase limits of the FlashDevice description.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FlashModel.h"
+#include "Crc32.h"
+
+#define QW_SIZE         16U             /* Quad-word */
+
+const FlashTiming_t FlashTiming_Default = {
+  1.0e-3,                               /* tCall:        ~8 USB transfers per call */
+  1.0e6,                                /* rateDownload: 1 MB/s */
+  50.0e-6,                              /* tQuadWord:    tprog 128 bits */
+  2.0e-3,                               /* tSectorErase: tERASE 8 KB */
+  0.5,                                  /* tMassErase:   both banks */
+  125.0e-6                              /* tPoll:        one USB transfer */
+};
+
+/* Sector index of an address, nSectors if outside */
+static uint32_t SectorIdx (const FlashModel_t *m, uint32_t adr) {
+  uint32_t sz, start, idx = 0U, i, end;
+  const FlmDevice_t *d = m->dev;
+
+  start = FlmDevice_Sector(d, adr, &sz);
+  if (sz == 0U) {
+    return (m->nSectors);
+  }
+  for (i = 0U; i < d->nSectors; i++) {
+    end = ((i + 1U) < d->nSectors) ? d->sectors[i + 1U].addrSector : d->szDev;
+    if ((start - d->devAdr) < end) {
+      return (idx + ((start - d->devAdr - d->sectors[i].addrSector) / d->sectors[i].szSector));
+    }
+    idx += (end - d->sectors[i].addrSector) / d->sectors[i].szSector;
+  }
+  return (m->nSectors);
+}
+
+/* Set or clear programmed marks of quad-words in [ofs, ofs + sz) */
+static void QwMark (FlashModel_t *m, uint32_t ofs, uint32_t sz, int prog) {
+  uint32_t qw;
+
+  for (qw = ofs / QW_SIZE; qw < ((ofs + sz) / QW_SIZE); qw++) {
+    if (prog) {
+      m->qwProg[qw / 8U] |=  (uint8_t)(1U << (qw % 8U));
+    } else {
+      m->qwProg[qw / 8U] &= (uint8_t)~(1U << (qw % 8U));
+    }
+  }
+}
+
+static int QwProgrammed (const FlashModel_t *m, uint32_t ofs) {
+  uint32_t qw = ofs / QW_SIZE;
+
+  return ((m->qwProg[qw / 8U] & (1U << (qw % 8U))) != 0U);
+}
+
+static int InRange (const FlashModel_t *m, uint32_t adr, uint32_t sz) {
+  return ((adr >= m->dev->devAdr) && ((adr - m->dev->devAdr) <= m->dev->szDev) &&
+          (sz <= (m->dev->szDev - (adr - m->dev->devAdr))));
+}
+
+/* Account a FlashOS call, returns ret */
+static int Account (FlashModel_t *m, double t, uint32_t toMs, double *tMax, int ret) {
+  m->time += m->timing.tCall + t;
+  m->nCalls++;
+  if (t > *tMax) {
+    *tMax = t;
+  }
+  if ((t * 1000.0) > (double)toMs) {
+    m->nTimeout++;
+  }
+  if (ret != 0) {
+    m->nFail++;
+  }
+  return (ret);
+}
+
+int FlashModel_Create (FlashModel_t *m, const FlmDevice_t *dev, const FlashTiming_t *timing, uint8_t fill) {
+  memset(m, 0, sizeof(*m));
+  m->dev      = dev;
+  m->timing   = (timing != NULL) ? *timing : FlashTiming_Default;
+  m->nSectors = FlmDevice_SectorCount(dev);
+  m->mem      = malloc(dev->szDev);
+  m->qwProg   = calloc((dev->szDev / (QW_SIZE * 8U)) + 1U, 1U);
+  m->prot     = calloc(m->nSectors + 1U, 1U);
+  if ((m->mem == NULL) || (m->qwProg == NULL) || (m->prot == NULL)) {
+    FlashModel_Destroy(m);
+    return (1);
+  }
+  memset(m->mem, fill, dev->szDev);
+  if (fill != dev->valEmpty) {
+    QwMark(m, 0U, dev->szDev, 1);
+  }
+  return (0);
+}
+
+void FlashModel_Destroy (FlashModel_t *m) {
+  free(m->mem);
+  free(m->qwProg);
+  free(m->prot);
+  m->mem    = NULL;
+  m->qwProg = NULL;
+  m->prot   = NULL;
+}
+
+void FlashModel_Protect (FlashModel_t *m, uint32_t adr, uint32_t sz, uint8_t reason) {
+  uint32_t end = adr + sz;
+  uint32_t idx, ssz;
+
+  while (adr < end) {
+    (void)FlmDevice_Sector(m->dev, adr, &ssz);
+    idx = SectorIdx(m, adr);
+    if ((ssz == 0U) || (idx >= m->nSectors)) {
+      break;
+    }
+    m->prot[idx] = reason;
+    adr += ssz;
+  }
+}
+
+int FlashModel_Init (FlashModel_t *m, uint32_t adr, uint32_t clk, uint32_t fnc) {
+  double tMax = 0.0;
+
+  (void)adr;
+  (void)clk;
+  m->fnc        = fnc;
+  m->crc        = 0U;
+  m->protAdr    = 0U;
+  m->protReason = FLASH_PROT_NONE;
+  return (Account(m, 0.0, 0xFFFFFFFFU, &tMax, 0));
+}
+
+int FlashModel_UnInit (FlashModel_t *m, uint32_t fnc) {
+  double tMax = 0.0;
+
+  (void)fnc;
+  m->fnc = 0U;
+  return (Account(m, 0.0, 0xFFFFFFFFU, &tMax, 0));
+}
+
+int FlashModel_EraseChip (FlashModel_t *m) {
+  uint32_t i, adr, sz;
+
+  if (m->fnc == 0U) {
+    return (Account(m, 0.0, m->dev->toErase, &m->maxErase, 1));
+  }
+  for (i = 0U, adr = m->dev->devAdr; i < m->nSectors; i++, adr += sz) {
+    adr = FlmDevice_Sector(m->dev, adr, &sz);
+    if (m->prot[i] != FLASH_PROT_NONE) {                /* fail fast, see FlashPrg.c */
+      m->protAdr    = adr;
+      m->protReason = m->prot[i];
+      return (Account(m, 0.0, m->dev->toErase, &m->maxErase, 1));
+    }
+  }
+  memset(m->mem, m->dev->valEmpty, m->dev->szDev);
+  QwMark(m, 0U, m->dev->szDev, 0);
+  m->nErase += m->nSectors;
+  return (Account(m, m->timing.tMassErase, 0xFFFFFFFFU, &m->maxErase, 0));
+}
+
+int FlashModel_EraseSector (FlashModel_t *m, uint32_t adr) {
+  uint32_t sz, start, idx;
+
+  start = FlmDevice_Sector(m->dev, adr, &sz);
+  idx   = SectorIdx(m, adr);
+  if ((m->fnc == 0U) || (sz == 0U) || (idx >= m->nSectors) || (m->prot[idx] != FLASH_PROT_NONE)) {
+    if ((m->fnc != 0U) && (idx < m->nSectors)) {
+      m->protAdr    = start;
+      m->protReason = m->prot[idx];
+    }
+    return (Account(m, 0.0, m->dev->toErase, &m->maxErase, 1));
+  }
+  memset(&m->mem[start - m->dev->devAdr], m->dev->valEmpty, sz);
+  QwMark(m, start - m->dev->devAdr, sz, 0);
+  m->nErase++;
+  return (Account(m, m->timing.tSectorErase, m->dev->toErase, &m->maxErase, 0));
+}
+
+/* Program quad-words, *nQw = programmed quad-words
+     Return Value: 0 - OK, 1 - Failed */
+static int Write (FlashModel_t *m, uint32_t adr, uint32_t len, const uint8_t *buf, uint32_t *nQw) {
+  uint32_t i, n, ofs, ssz;
+  uint32_t sz = (len + (QW_SIZE - 1U)) & ~(QW_SIZE - 1U); /* Adjust size for four words */
+  uint8_t  qw[QW_SIZE];
+
+  *nQw = 0U;
+  if ((m->fnc == 0U) || ((adr & (QW_SIZE - 1U)) != 0U) || !InRange(m, adr, sz)) {
+    return (1);
+  }
+  for (ofs = adr; ofs < (adr + sz); ofs += ssz) {
+    ofs = FlmDevice_Sector(m->dev, ofs, &ssz);
+    if (ssz == 0U) {
+      return (1);
+    }
+    if (m->prot[SectorIdx(m, ofs)] != FLASH_PROT_NONE) {
+      m->protAdr    = ofs;
+      m->protReason = m->prot[SectorIdx(m, ofs)];
+      return (1);
+    }
+  }
+
+  for (i = 0U; i < sz; i += QW_SIZE) {
+    ofs = adr - m->dev->devAdr + i;
+    if (QwProgrammed(m, ofs)) {                         /* quad-word programmed twice */
+      return (1);
+    }
+    for (n = 0U; n < QW_SIZE; n++) {                    /* source may be shorter than quad-word */
+      qw[n] = ((i + n) < len) ? buf[i + n] : m->dev->valEmpty;
+    }
+    memcpy(&m->mem[ofs], qw, QW_SIZE);
+    QwMark(m, ofs, QW_SIZE, 1);
+    m->crc = Crc32(m->crc, qw, QW_SIZE);                /* FlashCrcMode = 1 */
+    (*nQw)++;
+  }
+  return (0);
+}
+
+int FlashModel_ProgramPage (FlashModel_t *m, uint32_t adr, uint32_t sz, const uint8_t *buf) {
+  uint32_t n;
+  int      ret;
+
+  m->nProgram++;
+  ret = Write(m, adr, sz, buf, &n);
+  return (Account(m, ((double)sz / m->timing.rateDownload) +   /* download into page buffer */
+                     ((double)n * m->timing.tQuadWord), m->dev->toProg, &m->maxProg, ret));
+}
+
+/* Duration of a ProgramStream call of n quad-words */
+static double StreamTime (const FlashModel_t *m, uint32_t n, uint32_t ring) {
+  double   tIn1 = (double)QW_SIZE / m->timing.rateDownload;
+  double   tIn, tPrg;
+  uint32_t half = (ring / 2U) & ~(QW_SIZE - 1U);
+
+  if (n == 0U) {
+    return (0.0);
+  }
+  if (half < QW_SIZE) {
+    half = QW_SIZE;
+  }
+  tIn  = ((double)n * tIn1) +                           /* download, one 'rd' poll per refill */
+         ((double)(((n * QW_SIZE) + half - 1U) / half) * m->timing.tPoll);
+  tPrg = (double)n * m->timing.tQuadWord;
+  /* download and programming overlap, the slower one sets the pace */
+  return ((tIn > tPrg) ? (tIn + m->timing.tQuadWord) : (tPrg + tIn1));
+}
+
+int FlashModel_ProgramStream (FlashModel_t *m, uint32_t adr, uint32_t sz, uint32_t ring, const uint8_t *buf) {
+  uint32_t n;
+  int      ret;
+
+  m->nProgram++;
+  ret = Write(m, adr, sz, buf, &n);
+  return (Account(m, StreamTime(m, n, ring), m->dev->toProg, &m->maxProg, ret));
+}
+
+uint32_t FlashModel_StreamLimit (const FlashModel_t *m, uint32_t ring) {
+  double   limit = (double)m->dev->toProg * 1.0e-3 / 2.0;
+  uint32_t lo = 1U, hi = m->dev->szDev / QW_SIZE, mid;
+
+  while (lo < hi) {                                     /* largest n with StreamTime(n) <= limit */
+    mid = lo + ((hi - lo + 1U) / 2U);
+    if (StreamTime(m, mid, ring) <= limit) {
+      lo = mid;
+    } else {
+      hi = mid - 1U;
+    }
+  }
+  return (lo * QW_SIZE);
+}
+
+int FlashModel_CrcRange (FlashModel_t *m, uint32_t adr, uint32_t sz, uint32_t *crc) {
+  double tMax = 0.0;
+
+  if ((m->fnc == 0U) || !InRange(m, adr, sz)) {
+    return (Account(m, 0.0, 0xFFFFFFFFU, &tMax, 1));
+  }
+  *crc = Crc32(*crc, &m->mem[adr - m->dev->devAdr], sz);
+  return (Account(m, 0.0, 0xFFFFFFFFU, &tMax, 0));     /* on-target flash read is negligible */
+}
+
+int FlashModel_Read (FlashModel_t *m, uint32_t adr, uint32_t sz, uint8_t *buf) {
+  if (!InRange(m, adr, sz)) {
+    return (1);
+  }
+  memcpy(buf, &m->mem[adr - m->dev->devAdr], sz);
+  m->time += (double)sz / m->timing.rateDownload;
+  return (0);
+}
+
+int FlashTiming_Parse (FlashTiming_t *timing, const char *arg) {
+  static const struct {
+    const char *name;
+    size_t      ofs;
+  } Param[] = {
+    { "tCall",        offsetof(FlashTiming_t, tCall)        },
+    { "rateDownload", offsetof(FlashTiming_t, rateDownload) },
+    { "tQuadWord",    offsetof(FlashTiming_t, tQuadWord)    },
+    { "tSectorErase", offsetof(FlashTiming_t, tSectorErase) },
+    { "tMassErase",   offsetof(FlashTiming_t, tMassErase)   },
+    { "tPoll",        offsetof(FlashTiming_t, tPoll)        }
+  };
+  const char *eq = strchr(arg, '=');
+  char       *end;
+  double      val;
+  uint32_t    i;
+
+  if (eq == NULL) {
+    return (1);
+  }
+  val = strtod(eq + 1, &end);
+  if ((*end != '\0') || (val <= 0.0)) {
+    return (1);
+  }
+  for (i = 0U; i < (sizeof(Param) / sizeof(Param[0])); i++) {
+    if ((strlen(Param[i].name) == (size_t)(eq - arg)) && (strncmp(arg, Param[i].name, (size_t)(eq - arg)) == 0)) {
+      *(double *)((uint8_t *)timing + Param[i].ofs) = val;
+      return (0);
+    }
+  }
+  return (1);
+}
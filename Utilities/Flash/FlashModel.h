@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLASH_MODEL_H_
+#define FLASH_MODEL_H_
+
+#include <stdint.h>
+#include "FlmDevice.h"
+
+/* Sector protection reasons, same values as FlashPrg.c (FlashProtReason) */
+#define FLASH_PROT_NONE         0U
+#define FLASH_PROT_WRP          1U
+#define FLASH_PROT_HDP          2U
+#define FLASH_PROT_SECWM        3U
+#define FLASH_PROT_EDATA        4U
+
+/* Timing model (seconds, bytes/s) */
+typedef struct {
+  double   tCall;                       /* Debugger cost per FlashOS call: halt, register setup, resume */
+  double   rateDownload;                /* Probe download rate into the algorithm page buffer */
+  double   tQuadWord;                   /* Program one quad-word (16 bytes) */
+  double   tSectorErase;                /* Erase one sector */
+  double   tMassErase;                  /* Erase both banks (EraseChip) */
+  double   tPoll;                       /* Debugger memory read round trip (ProgramStream ring poll) */
+} FlashTiming_t;
+
+/* Modeled STM32H5 flash controller behind the FlashOS interface */
+typedef struct {
+  const FlmDevice_t *dev;               /* Geometry and timeouts from the .FLM */
+  FlashTiming_t      timing;
+  uint8_t           *mem;               /* Flash content (dev->szDev bytes) */
+  uint8_t           *qwProg;            /* Programmed quad-word bitmap, cleared by erase only */
+  uint8_t           *prot;              /* Protection reason per sector */
+  uint32_t           nSectors;
+  uint32_t           fnc;               /* Function code of last Init, 0 = not initialized */
+  double             time;              /* Accumulated modeled time (s) */
+  double             maxProg;           /* Longest ProgramPage call (s) */
+  double             maxErase;          /* Longest EraseSector call (s) */
+  uint32_t           nCalls;            /* FlashOS calls */
+  uint32_t           nErase;            /* Erased sectors */
+  uint32_t           nProgram;          /* ProgramPage calls */
+  uint32_t           nFail;             /* Failed calls */
+  uint32_t           nTimeout;          /* Calls exceeding toProg/toErase */
+  uint32_t           crc;               /* CRC-32 of programmed quad-words since Init (FlashCrc) */
+  uint32_t           protAdr;           /* Sector of the last protection failure (FlashProtAdr) */
+  uint32_t           protReason;        /* FLASH_PROT_xxx of that sector (FlashProtReason) */
+} FlashModel_t;
+
+/* Default timing: STM32H5 datasheet typical values, CMSIS-DAP v2 probe */
+extern const FlashTiming_t FlashTiming_Default;
+
+/* Create model, flash content is initialized with fill, all quad-words
+   count as programmed unless fill is the erased value
+     Return Value: 0 - OK, 1 - Failed */
+extern int  FlashModel_Create  (FlashModel_t *m, const FlmDevice_t *dev, const FlashTiming_t *timing, uint8_t fill);
+extern void FlashModel_Destroy (FlashModel_t *m);
+
+/* Mark sector range as protected (see FLASH_PROT_xxx) */
+extern void FlashModel_Protect (FlashModel_t *m, uint32_t adr, uint32_t sz, uint8_t reason);
+
+/* FlashOS functions, return 0 - OK, 1 - Failed */
+extern int FlashModel_Init        (FlashModel_t *m, uint32_t adr, uint32_t clk, uint32_t fnc);
+extern int FlashModel_UnInit      (FlashModel_t *m, uint32_t fnc);
+extern int FlashModel_EraseChip   (FlashModel_t *m);
+extern int FlashModel_EraseSector (FlashModel_t *m, uint32_t adr);
+extern int FlashModel_ProgramPage (FlashModel_t *m, uint32_t adr, uint32_t sz, const uint8_t *buf);
+
+/* ProgramStream: one call, host fills the SRAM ring of ring bytes while the target
+   programs and polls 'rd' once per refill of half the ring, the whole call is
+   limited by toProg (see CMSIS/Flash/STM32H5xx/FlashStream.h) */
+extern int FlashModel_ProgramStream (FlashModel_t *m, uint32_t adr, uint32_t sz, uint32_t ring, const uint8_t *buf);
+
+/* Largest ProgramStream size whose predicted duration stays below toProg / 2 */
+extern uint32_t FlashModel_StreamLimit (const FlashModel_t *m, uint32_t ring);
+
+/* CrcRange: CRC-32 of flash content computed on target, one call */
+extern int FlashModel_CrcRange (FlashModel_t *m, uint32_t adr, uint32_t sz, uint32_t *crc);
+
+/* Memory read through the debug probe (content and time) */
+extern int FlashModel_Read (FlashModel_t *m, uint32_t adr, uint32_t sz, uint8_t *buf);
+
+/* Parse timing override 'name=value' (tCall, rateDownload, tQuadWord, tSectorErase, tMassErase, tPoll)
+     Return Value: 0 - OK, 1 - Failed */
+extern int FlashTiming_Parse (FlashTiming_t *timing, const char *arg);
+
+#endif /* FLASH_MODEL_H_ */
@@ -0,0 +1,643 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Flash operation planner
+ *
+ * Computes the fastest FlashOS call sequence for an image and predicts
+ * its duration by executing the plan on the modeled flash controller:
+ *  - sectors whose image bytes are already on target are skipped
+ *  - on an erased target (-e) sectors are programmed without erase; a read
+ *    back value cannot tell an erased quad-word from one programmed with
+ *    the erased value (ECC), so differing sectors of -r are always erased
+ *  - sector erase or EraseChip, whichever is faster and keeps content
+ *    outside the image (EraseChip only with -c or known target content);
+ *    FlashOS has no bank erase entry, so a bank erase (BER) is not an
+ *    option even when the image covers a whole bank
+ *  - ProgramPage batches merge quad-words up to szPage, small gaps are
+ *    bridged when that is cheaper than an extra call, batch size is
+ *    limited so the predicted duration stays below toProg / 2
+ *  - an image linked for the other secure/non-secure alias is relocated
+ *  - sectors are processed upper bank first; the boot sector is erased and
+ *    programmed in a final session after all other sectors are programmed,
+ *    so an interrupted run keeps the old reset vector (not with EraseChip)
+ *
+ * Usage: FlashPlan [-t name=value]... [-b adr] [-r file | -e] [-c] [-q] image [file.FLM]
+ *   -t   override timing model parameter (see FlashTiming_Parse)
+ *   -b   load address of a binary image (default: devAdr of the .FLM)
+ *   -r   current target content (ELF, HEX or binary read back from target)
+ *   -e   target is erased
+ *   -c   content outside the image may be lost (allows EraseChip)
+ *   -q   print the summary only
+ *   without .FLM the STM32H5xx 2M non-secure geometry is used
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FlmDevice.h"
+#include "FlashModel.h"
+#include "Image.h"
+
+#define QW_SIZE         16U             /* Quad-word */
+#define ALIAS_BIT       0x04000000U     /* Secure (0x0C000000) / non-secure (0x08000000) alias */
+
+/* Sector actions */
+#define ACT_NONE        0U              /* not part of the image */
+#define ACT_SKIP        1U              /* identical on target */
+#define ACT_PROGRAM     2U              /* target erased (-e), no erase */
+#define ACT_ERASE       3U              /* erase and program */
+
+/* Operations */
+#define OP_INIT         0U
+#define OP_UNINIT       1U
+#define OP_ERASE_CHIP   2U
+#define OP_ERASE_SECTOR 3U
+#define OP_PROGRAM      4U
+
+static const char *OpName[] = { "Init", "UnInit", "EraseChip", "EraseSector", "ProgramPage" };
+
+typedef struct {
+  uint32_t op;
+  uint32_t adr;
+  uint32_t size;                        /* ProgramPage size, Init/UnInit function code */
+  double   t;                           /* Predicted duration including call overhead (s) */
+} Op_t;
+
+typedef struct {
+  Op_t    *op;
+  uint32_t nOp;
+  uint32_t maxOp;
+  double   time;                        /* Predicted total (s) */
+  double   maxProg;                     /* Longest ProgramPage (s) */
+  double   maxErase;                    /* Longest EraseSector (s) */
+  uint32_t nErase;                      /* Erased sectors */
+  uint32_t nProgram;                    /* ProgramPage calls */
+  uint32_t bytes;                       /* Programmed bytes */
+  uint32_t nTimeout;                    /* Calls exceeding toProg/toErase */
+  uint32_t nFail;                       /* Failed calls */
+  uint32_t nDiff;                       /* Image bytes not on target after the plan */
+  uint32_t crc[2];                      /* Expected FlashCrc per program session (program order) */
+  uint32_t nCrc;
+} Plan_t;
+
+typedef struct {
+  const FlmDevice_t *dev;
+  FlashTiming_t      timing;
+  uint8_t           *want;              /* Image content, valEmpty outside image */
+  uint8_t           *used;              /* Image byte mask */
+  uint8_t           *tgt;               /* Target content, NULL if unknown */
+  uint32_t           erased;            /* Target known to be erased (-e) */
+  uint8_t           *prog;              /* Quad-word program marks */
+  uint32_t           nSectors;
+  uint32_t          *secAdr;            /* Sector offset to devAdr */
+  uint32_t          *secSize;
+  uint8_t           *act;               /* Sector action */
+  uint32_t          *order;             /* Sector processing order */
+  uint32_t           maxBatch;          /* ProgramPage size limit */
+} Ctx_t;
+
+
+static int AddOp (Plan_t *p, uint32_t op, uint32_t adr, uint32_t size) {
+  Op_t *o;
+
+  if (p->nOp == p->maxOp) {
+    p->maxOp = (p->maxOp != 0U) ? (p->maxOp * 2U) : 256U;
+    o = realloc(p->op, p->maxOp * sizeof(Op_t));
+    if (o == NULL) {
+      return (1);
+    }
+    p->op = o;
+  }
+  o = &p->op[p->nOp++];
+  o->op   = op;
+  o->adr  = adr;
+  o->size = size;
+  o->t    = 0.0;
+  return (0);
+}
+
+static int QwBlank (const Ctx_t *c, const uint8_t *mem, uint32_t ofs) {
+  uint32_t i;
+
+  for (i = 0U; i < QW_SIZE; i++) {
+    if (mem[ofs + i] != c->dev->valEmpty) {
+      return (0);
+    }
+  }
+  return (1);
+}
+
+static int QwUsed (const Ctx_t *c, uint32_t ofs) {
+  uint32_t i;
+
+  for (i = 0U; i < QW_SIZE; i++) {
+    if (c->used[ofs + i] != 0U) {
+      return (1);
+    }
+  }
+  return (0);
+}
+
+/* Classify sectors against the target content */
+static void Classify (Ctx_t *c) {
+  uint32_t s, ofs, i, differs, erase, touched;
+
+  for (s = 0U; s < c->nSectors; s++) {
+    touched = 0U;
+    differs = 0U;
+    erase   = 0U;
+    for (ofs = c->secAdr[s]; ofs < (c->secAdr[s] + c->secSize[s]); ofs += QW_SIZE) {
+      uint32_t d = 0U;
+
+      if (!QwUsed(c, ofs)) {
+        continue;
+      }
+      touched = 1U;
+      if (c->tgt == NULL) {
+        continue;
+      }
+      for (i = 0U; i < QW_SIZE; i++) {
+        if ((c->used[ofs + i] != 0U) && (c->want[ofs + i] != c->tgt[ofs + i])) {
+          d = 1U;
+        }
+      }
+      if ((d != 0U) && (c->erased == 0U)) {
+        erase = 1U;                                     /* read back blank may be programmed (ECC) */
+      }
+      differs |= d;
+    }
+    if (touched == 0U) {
+      c->act[s] = ACT_NONE;
+    } else if (c->tgt == NULL) {
+      c->act[s] = ACT_ERASE;
+    } else if (differs == 0U) {
+      c->act[s] = ACT_SKIP;
+    } else {
+      c->act[s] = (erase != 0U) ? ACT_ERASE : ACT_PROGRAM;
+    }
+  }
+}
+
+/* Target bytes outside the image lost by erasing sector s */
+static uint32_t LostBytes (const Ctx_t *c, uint32_t s) {
+  uint32_t ofs, n = 0U;
+
+  for (ofs = c->secAdr[s]; ofs < (c->secAdr[s] + c->secSize[s]); ofs++) {
+    if ((c->used[ofs] == 0U) && (c->tgt[ofs] != c->dev->valEmpty)) {
+      n++;
+    }
+  }
+  return (n);
+}
+
+/* Mark quad-words to program, chip = all sectors erased before */
+static void MarkProgram (Ctx_t *c, int chip) {
+  uint32_t s, ofs, i;
+
+  memset(c->prog, 0, c->dev->szDev / QW_SIZE);
+  for (s = 0U; s < c->nSectors; s++) {
+    if ((c->act[s] == ACT_NONE) || ((c->act[s] == ACT_SKIP) && !chip)) {
+      continue;
+    }
+    for (ofs = c->secAdr[s]; ofs < (c->secAdr[s] + c->secSize[s]); ofs += QW_SIZE) {
+      if (!QwUsed(c, ofs)) {
+        continue;
+      }
+      if (chip || (c->act[s] == ACT_ERASE)) {
+        c->prog[ofs / QW_SIZE] = QwBlank(c, c->want, ofs) ? 0U : 1U;
+      } else {                                          /* ACT_PROGRAM: differing quad-words only */
+        for (i = 0U; i < QW_SIZE; i++) {
+          if ((c->used[ofs + i] != 0U) && (c->want[ofs + i] != c->tgt[ofs + i])) {
+            c->prog[ofs / QW_SIZE] = 1U;
+          }
+        }
+      }
+    }
+  }
+}
+
+/* Gap quad-word may be programmed with its image content (erased value outside image) */
+static int Bridgeable (const Ctx_t *c, uint32_t s, uint32_t ofs, int chip) {
+  if (chip || (c->act[s] == ACT_ERASE)) {
+    return (1);
+  }
+  return ((c->erased != 0U) && QwBlank(c, c->want, ofs));
+}
+
+/* Append ProgramPage batches of sector s */
+static int AddProgram (Ctx_t *c, Plan_t *p, uint32_t s, int chip) {
+  const FlashTiming_t *t = &c->timing;
+  double   tQw = ((double)QW_SIZE / t->rateDownload) + t->tQuadWord;
+  uint32_t ofs, end, start = 0U, last = 0U, g, n;
+  int      open = 0;
+
+  end = c->secAdr[s] + c->secSize[s];
+  for (ofs = c->secAdr[s]; ofs < end; ofs += QW_SIZE) {
+    if (c->prog[ofs / QW_SIZE] == 0U) {
+      continue;
+    }
+    if (open) {
+      /* extend batch: same page, size limit, gap cheaper than a new call */
+      n = (ofs - last) / QW_SIZE - 1U;
+      if (((ofs / c->dev->szPage) == (start / c->dev->szPage)) &&
+          ((ofs + QW_SIZE - start) <= c->maxBatch) &&
+          (((double)n * tQw) < t->tCall)) {
+        for (g = last + QW_SIZE; g < ofs; g += QW_SIZE) {
+          if (!Bridgeable(c, s, g, chip)) {
+            break;
+          }
+        }
+        if (g == ofs) {
+          last = ofs;
+          continue;
+        }
+      }
+      if (AddOp(p, OP_PROGRAM, c->dev->devAdr + start, last + QW_SIZE - start) != 0) {
+        return (1);
+      }
+    }
+    open  = 1;
+    start = ofs;
+    last  = ofs;
+  }
+  if (open) {
+    return (AddOp(p, OP_PROGRAM, c->dev->devAdr + start, last + QW_SIZE - start));
+  }
+  return (0);
+}
+
+/* Append erase and program sessions for order[first..last) */
+static int AddSessions (Ctx_t *c, Plan_t *p, uint32_t first, uint32_t last, int chip) {
+  uint32_t i, s;
+  int      ret = 0;
+
+  ret |= AddOp(p, OP_INIT, c->dev->devAdr, 1U);
+  if (chip) {
+    ret |= AddOp(p, OP_ERASE_CHIP, c->dev->devAdr, c->dev->szDev);
+  } else {
+    for (i = first; i < last; i++) {
+      s = c->order[i];
+      if (c->act[s] == ACT_ERASE) {
+        ret |= AddOp(p, OP_ERASE_SECTOR, c->dev->devAdr + c->secAdr[s], c->secSize[s]);
+      }
+    }
+  }
+  ret |= AddOp(p, OP_UNINIT, c->dev->devAdr, 1U);
+
+  ret |= AddOp(p, OP_INIT, c->dev->devAdr, 2U);
+  for (i = first; i < last; i++) {
+    ret |= AddProgram(c, p, c->order[i], chip);
+  }
+  ret |= AddOp(p, OP_UNINIT, c->dev->devAdr, 2U);
+  return (ret);
+}
+
+/* Build the operation list, chip = use EraseChip */
+static int Build (Ctx_t *c, Plan_t *p, int chip) {
+  uint32_t boot = c->order[c->nSectors - 1U];           /* last in order */
+
+  MarkProgram(c, chip);
+
+  if (chip || (c->act[boot] != ACT_ERASE)) {
+    return (AddSessions(c, p, 0U, c->nSectors, chip));
+  }
+  /* boot sector erased only after all other sectors are programmed */
+  return (AddSessions(c, p, 0U, c->nSectors - 1U, 0) |
+          AddSessions(c, p, c->nSectors - 1U, c->nSectors, 0));
+}
+
+/* Execute the plan on the modeled controller, record predicted times */
+static int Simulate (Ctx_t *c, Plan_t *p) {
+  const FlmDevice_t *dev = c->dev;
+  FlashModel_t m;
+  uint32_t     i, ofs;
+  double       t0;
+  Op_t        *o;
+
+  /* read back or unknown target: all quad-words count as programmed (ECC) */
+  if (FlashModel_Create(&m, dev, &c->timing, (c->erased != 0U) ? dev->valEmpty : (uint8_t)~dev->valEmpty) != 0) {
+    return (1);
+  }
+  if (c->tgt != NULL) {
+    memcpy(m.mem, c->tgt, dev->szDev);
+  }
+
+  for (i = 0U; i < p->nOp; i++) {
+    o  = &p->op[i];
+    t0 = m.time;
+    switch (o->op) {
+      case OP_INIT:
+        (void)FlashModel_Init(&m, o->adr, 0U, o->size);
+        break;
+      case OP_UNINIT:
+        if ((o->size == 2U) && (p->nCrc < 2U)) {
+          p->crc[p->nCrc++] = m.crc;                    /* FlashCrc read before UnInit */
+        }
+        (void)FlashModel_UnInit(&m, o->size);
+        break;
+      case OP_ERASE_CHIP:
+        (void)FlashModel_EraseChip(&m);
+        break;
+      case OP_ERASE_SECTOR:
+        (void)FlashModel_EraseSector(&m, o->adr);
+        if ((m.time - t0 - m.timing.tCall) > p->maxErase) {
+          p->maxErase = m.time - t0 - m.timing.tCall;
+        }
+        break;
+      case OP_PROGRAM:
+        (void)FlashModel_ProgramPage(&m, o->adr, o->size, &c->want[o->adr - dev->devAdr]);
+        if ((m.time - t0 - m.timing.tCall) > p->maxProg) {
+          p->maxProg = m.time - t0 - m.timing.tCall;
+        }
+        p->bytes += o->size;
+        break;
+      default:
+        break;
+    }
+    o->t = m.time - t0;
+  }
+
+  p->time     = m.time;
+  p->nErase   = m.nErase;
+  p->nProgram = m.nProgram;
+  p->nTimeout = m.nTimeout;
+  p->nFail    = m.nFail;
+  for (ofs = 0U; ofs < dev->szDev; ofs++) {
+    if ((c->used[ofs] != 0U) && (m.mem[ofs] != c->want[ofs])) {
+      p->nDiff++;
+    }
+  }
+  FlashModel_Destroy(&m);
+  return (0);
+}
+
+/* Map image into device range, an image linked completely for the other
+   secure/non-secure alias is relocated
+     Return Value: bytes outside the device */
+static uint32_t MapImage (const FlmDevice_t *dev, const Image_t *img, uint8_t *mem, uint8_t *used) {
+  uint32_t i, j, ofs, alias = ALIAS_BIT, out = 0U;
+
+  for (i = 0U; i < img->nSeg; i++) {
+    if ((img->seg[i].adr < ((uint64_t)dev->devAdr + dev->szDev)) &&
+        (((uint64_t)img->seg[i].adr + img->seg[i].size) > dev->devAdr)) {
+      alias = 0U;                                       /* image has content in devAdr range */
+    }
+  }
+  for (i = 0U; i < img->nSeg; i++) {
+    for (j = 0U; j < img->seg[i].size; j++) {
+      ofs = ((img->seg[i].adr + j) ^ alias) - dev->devAdr;
+      if (ofs >= dev->szDev) {
+        out++;
+        continue;
+      }
+      mem[ofs] = img->seg[i].data[j];
+      if (used != NULL) {
+        used[ofs] = 1U;
+      }
+    }
+  }
+  return (out);
+}
+
+/* Sector list and processing order: upper bank, lower bank, boot sector last */
+static int Sectors (Ctx_t *c) {
+  const FlmDevice_t *dev = c->dev;
+  uint32_t adr, sz, s, i, n = 0U;
+
+  c->nSectors = FlmDevice_SectorCount(dev);
+  c->secAdr   = malloc(c->nSectors * sizeof(uint32_t));
+  c->secSize  = malloc(c->nSectors * sizeof(uint32_t));
+  c->order    = malloc(c->nSectors * sizeof(uint32_t));
+  c->act      = calloc(c->nSectors, 1U);
+  if ((c->secAdr == NULL) || (c->secSize == NULL) || (c->order == NULL) || (c->act == NULL)) {
+    return (1);
+  }
+  for (s = 0U, adr = dev->devAdr; s < c->nSectors; s++, adr += sz) {
+    adr = FlmDevice_Sector(dev, adr, &sz);
+    if (sz == 0U) {
+      c->nSectors = s;
+      break;
+    }
+    c->secAdr[s]  = adr - dev->devAdr;
+    c->secSize[s] = sz;
+  }
+  for (s = 0U; s < c->nSectors; s++) {
+    if (c->secAdr[s] >= (dev->szDev / 2U)) {
+      c->order[n++] = s;
+    }
+  }
+  for (i = 1U; i <= c->nSectors; i++) {
+    s = i % c->nSectors;                                /* sector 0 last */
+    if (c->secAdr[s] < (dev->szDev / 2U)) {
+      c->order[n++] = s;
+    }
+  }
+  return (0);
+}
+
+static void PrintPlan (const Plan_t *p) {
+  uint32_t i;
+
+  printf("%5s  %-12s %-10s %10s %10s\n", "#", "operation", "address", "size", "time [ms]");
+  for (i = 0U; i < p->nOp; i++) {
+    printf("%5u  %-12s 0x%08X %10u %10.3f\n", (unsigned int)(i + 1U), OpName[p->op[i].op],
+           (unsigned int)p->op[i].adr, (unsigned int)p->op[i].size, p->op[i].t * 1000.0);
+  }
+}
+
+int main (int argc, char *argv[]) {
+  FlashTiming_t timing = FlashTiming_Default;
+  FlmDevice_t  *dev;
+  Image_t       img, ref;
+  Ctx_t         c;
+  Plan_t        sec, chip;
+  const Plan_t *plan;
+  const char   *imgPath = NULL, *flmPath = NULL, *refPath = NULL;
+  uint32_t      binAdr = 0U, binSet = 0U, erased = 0U, lossOk = 0U, quiet = 0U;
+  uint32_t      out, s, n, lostChip = 0U, lostSec = 0U;
+  uint32_t      cnt[4] = { 0U };
+  double        tPerByte, limit;
+  int           i, chipOk, ret = 0;
+
+  for (i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-t") == 0) && ((i + 1) < argc)) {
+      if (FlashTiming_Parse(&timing, argv[++i]) != 0) {
+        fprintf(stderr, "Invalid timing parameter: %s\n", argv[i]);
+        return (2);
+      }
+    } else if ((strcmp(argv[i], "-b") == 0) && ((i + 1) < argc)) {
+      binAdr = (uint32_t)strtoul(argv[++i], NULL, 0);
+      binSet = 1U;
+    } else if ((strcmp(argv[i], "-r") == 0) && ((i + 1) < argc)) {
+      refPath = argv[++i];
+    } else if (strcmp(argv[i], "-e") == 0) {
+      erased = 1U;
+    } else if (strcmp(argv[i], "-c") == 0) {
+      lossOk = 1U;
+    } else if (strcmp(argv[i], "-q") == 0) {
+      quiet = 1U;
+    } else if ((argv[i][0] != '-') && (imgPath == NULL)) {
+      imgPath = argv[i];
+    } else if ((argv[i][0] != '-') && (flmPath == NULL)) {
+      flmPath = argv[i];
+    } else {
+      imgPath = NULL;
+      break;
+    }
+  }
+  if ((imgPath == NULL) || ((refPath != NULL) && (erased != 0U))) {
+    fprintf(stderr, "Usage: %s [-t name=value]... [-b adr] [-r file | -e] [-c] [-q] image [file.FLM]\n", argv[0]);
+    return (2);
+  }
+
+  dev = malloc(sizeof(*dev));
+  if (dev == NULL) {
+    return (1);
+  }
+  if (flmPath == NULL) {
+    FlmDevice_Default(dev, 0x08000000U, 0x00200000U);
+  } else if (FlmDevice_Load(flmPath, dev) != 0) {
+    fprintf(stderr, "Cannot read FlashDevice from %s\n", flmPath);
+    free(dev);
+    return (1);
+  }
+  if (Image_Load(&img, imgPath, (binSet != 0U) ? binAdr : dev->devAdr) != 0) {
+    fprintf(stderr, "Cannot read image %s\n", imgPath);
+    free(dev);
+    return (1);
+  }
+
+  memset(&c, 0, sizeof(c));
+  memset(&sec, 0, sizeof(sec));
+  memset(&chip, 0, sizeof(chip));
+  c.dev    = dev;
+  c.timing = timing;
+  c.erased = erased;
+  c.want   = malloc(dev->szDev);
+  c.used   = calloc(dev->szDev, 1U);
+  c.prog   = malloc(dev->szDev / QW_SIZE);
+  if ((refPath != NULL) || (erased != 0U)) {
+    c.tgt = malloc(dev->szDev);
+  }
+  if ((c.want == NULL) || (c.used == NULL) || (c.prog == NULL) ||
+      (((refPath != NULL) || (erased != 0U)) && (c.tgt == NULL)) || (Sectors(&c) != 0)) {
+    ret = 1;
+    goto exit;
+  }
+
+  memset(c.want, dev->valEmpty, dev->szDev);
+  out = MapImage(dev, &img, c.want, c.used);
+  if (out != 0U) {
+    fprintf(stderr, "Warning: %u image bytes outside %s ignored\n", (unsigned int)out, dev->devName);
+  }
+  if (c.tgt != NULL) {
+    memset(c.tgt, dev->valEmpty, dev->szDev);
+  }
+  if (refPath != NULL) {
+    if (Image_Load(&ref, refPath, (binSet != 0U) ? binAdr : dev->devAdr) != 0) {
+      fprintf(stderr, "Cannot read target content %s\n", refPath);
+      ret = 1;
+      goto exit;
+    }
+    (void)MapImage(dev, &ref, c.tgt, NULL);
+    Image_Free(&ref);
+  }
+
+  /* ProgramPage size limit: predicted duration below toProg / 2 */
+  tPerByte   = (1.0 / timing.rateDownload) + (timing.tQuadWord / QW_SIZE);
+  limit      = ((double)dev->toProg * 1.0e-3 / 2.0) / tPerByte;
+  c.maxBatch = (limit < (double)dev->szPage) ? ((uint32_t)limit & ~(QW_SIZE - 1U)) : dev->szPage;
+  if (c.maxBatch < QW_SIZE) {
+    c.maxBatch = QW_SIZE;
+  }
+
+  Classify(&c);
+  for (s = 0U; s < c.nSectors; s++) {
+    cnt[c.act[s]]++;
+    if (c.tgt != NULL) {
+      n = LostBytes(&c, s);
+      if (c.act[s] == ACT_ERASE) {
+        lostSec  += n;
+      } else {
+        lostChip += n;
+      }
+    }
+  }
+
+  /* EraseChip only when it does not destroy more than sector erase */
+  chipOk = (lossOk != 0U) || ((c.tgt != NULL) && (lostChip == 0U));
+  ret |= Build(&c, &sec, 0);
+  ret |= Simulate(&c, &sec);
+  if (chipOk) {
+    ret |= Build(&c, &chip, 1);
+    ret |= Simulate(&c, &chip);
+  }
+  if (ret != 0) {
+    goto exit;
+  }
+  plan = (chipOk && (chip.time < sec.time)) ? &chip : &sec;
+
+  printf("Device:  %s (0x%08X, %uK, page %u, toProg %u ms, toErase %u ms)\n", dev->devName,
+         (unsigned int)dev->devAdr, (unsigned int)(dev->szDev >> 10), (unsigned int)dev->szPage,
+         (unsigned int)dev->toProg, (unsigned int)dev->toErase);
+  printf("Target:  %s\n", (refPath != NULL) ? refPath : ((erased != 0U) ? "erased" : "unknown"));
+  printf("Sectors: %u erase, %u program only, %u identical, %u untouched\n",
+         (unsigned int)cnt[ACT_ERASE], (unsigned int)cnt[ACT_PROGRAM],
+         (unsigned int)cnt[ACT_SKIP], (unsigned int)cnt[ACT_NONE]);
+  if (!quiet) {
+    PrintPlan(plan);
+  }
+  printf("Plan:    sector erase %.3f s", sec.time);
+  if (chipOk) {
+    printf(", EraseChip %.3f s", chip.time);
+  } else {
+    printf(", EraseChip not allowed (%s)", (c.tgt == NULL) ? "target unknown" : "content outside image");
+  }
+  printf(" -> %s\n", (plan == &chip) ? "EraseChip" : "sector erase");
+  printf("Predict: %.3f s, %u erased sectors, %u ProgramPage calls, %u bytes, %u lost bytes outside image\n",
+         plan->time, (unsigned int)plan->nErase, (unsigned int)plan->nProgram, (unsigned int)plan->bytes,
+         (unsigned int)((plan == &chip) ? (lostSec + lostChip) : lostSec));
+  printf("Limits:  ProgramPage <= %u bytes, longest %.3f ms of %u ms, EraseSector %.3f ms of %u ms%s\n",
+         (unsigned int)c.maxBatch, plan->maxProg * 1000.0, (unsigned int)dev->toProg,
+         plan->maxErase * 1000.0, (unsigned int)dev->toErase, (plan->nTimeout != 0U) ? ", TIMEOUT" : "");
+  printf("Verify:  %s, FlashCrc 0x%08X", ((plan->nFail == 0U) && (plan->nDiff == 0U)) ? "OK" : "FAILED",
+         (unsigned int)plan->crc[0]);
+  if (plan->nCrc > 1U) {
+    printf(", boot sector session 0x%08X", (unsigned int)plan->crc[1]);
+  }
+  printf("\n");
+  if ((plan->nFail != 0U) || (plan->nDiff != 0U) || (plan->nTimeout != 0U)) {
+    ret = 1;
+  }
+
+exit:
+  free(sec.op);
+  free(chip.op);
+  free(c.want);
+  free(c.used);
+  free(c.tgt);
+  free(c.prog);
+  free(c.secAdr);
+  free(c.secSize);
+  free(c.act);
+  free(c.order);
+  Image_Free(&img);
+  free(dev);
+  return (ret);
+}
@@ -0,0 +1,69 @@
+#!/bin/sh
+#
+# Copyright (c) 2026 Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# FlashPlan decisions on the FlashBench corpus
+#
+# Each case runs FlashPlan on a corpus image with -e, -r or -c and checks
+# the sector actions, whether EraseChip is considered, the chosen erase
+# method and that the plan verifies on the flash model. FlashOS has no
+# bank erase entry, so the choice is between sector erase and EraseChip.
+# tSectorErase=0.2 makes EraseChip the faster method for the 512K image.
+#
+# Usage: ./FlashPlanTest.sh [work dir]
+
+set -e
+cd "$(dirname "$0")"
+W=${1:-${TMPDIR:-/tmp}/FlashPlanTest}
+CC=${CC:-cc}
+C=$W/corpus
+
+mkdir -p "$C"
+$CC -O2 -o "$W/FlashBench" FlashBench.c FlashModel.c FlmDevice.c Crc32.c Corpus.c
+$CC -O2 -o "$W/FlashPlan"  FlashPlan.c  FlashModel.c FlmDevice.c Crc32.c Image.c
+"$W/FlashBench" -w "$C" > /dev/null
+
+fail=0
+# case: options | image | sector actions | EraseChip | chosen method
+check() {
+  out=$("$W/FlashPlan" -q $1 "$C/${2}_2048K.hex") || { echo "FAIL $1 $2: exit status"; fail=1; return; }
+  ok=1
+  echo "$out" | grep -q "^Sectors: $3," || ok=0
+  echo "$out" | grep -q "^Plan: .*$4.* -> $5\$" || ok=0
+  echo "$out" | grep -q "^Verify:  OK" || ok=0
+  if [ $ok -eq 1 ]; then
+    echo "ok   $2 $1"
+  else
+    echo "FAIL $2 $1"
+    echo "$out" | grep "^Sectors\|^Plan\|^Verify"
+    fail=1
+  fi
+}
+
+check ""                                         "dense"  "64 erase, 0 program only, 0 identical" "EraseChip not allowed (target unknown)"        "sector erase"
+check "-e"                                       "dense"  "0 erase, 64 program only, 0 identical" "EraseChip [0-9.]* s"                           "sector erase"
+check "-r $C/dense_2048K.hex"                    "dense"  "0 erase, 0 program only, 64 identical" "EraseChip [0-9.]* s"                           "sector erase"
+check "-r $C/bank_2048K.hex"                     "dense"  "64 erase, 0 program only, 0 identical" "EraseChip not allowed (content outside image)" "sector erase"
+check "-r $C/code_2048K.hex -t tSectorErase=0.2" "dense"  "64 erase, 0 program only, 0 identical" "EraseChip [0-9.]* s"                           "EraseChip"
+check "-t tSectorErase=0.2"                      "dense"  "64 erase, 0 program only, 0 identical" "EraseChip not allowed (target unknown)"        "sector erase"
+check "-c -t tSectorErase=0.2"                   "dense"  "64 erase, 0 program only, 0 identical" "EraseChip [0-9.]* s"                           "EraseChip"
+check "-c"                                       "dense"  "64 erase, 0 program only, 0 identical" "EraseChip [0-9.]* s"                           "sector erase"
+check "-c"                                       "sparse" "16 erase, 0 program only, 0 identical" "EraseChip [0-9.]* s"                           "sector erase"
+check "-e -c -t tSectorErase=0.2"                "sparse" "0 erase, 16 program only, 0 identical" "EraseChip [0-9.]* s"                           "sector erase"
+
+exit $fail
@@ -0,0 +1,41 @@
+#!/bin/sh
+#
+# Copyright (c) 2026 Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Host build of the flash algorithm
+#
+# Builds CMSIS/Flash/STM32H5xx/FlashPrg.c for the host (FLASH_HOST, as the
+# STM32H5xx_2M_NSecure target with FLASH_EXT) into <work dir>/FlashPrgTest.
+# Used by FlashPrgTest.sh, FlashDumpTest.sh and FlashCrcTest.sh.
+#
+# Usage: ./FlashPrgBuild.sh <work dir>
+
+set -e
+cd "$(dirname "$0")"
+W=$1
+CC=${CC:-cc}
+S=../../CMSIS/Flash
+
+# device sources with Windows include paths and CRLF line ends
+mkdir -p "$W/src/STM32H5xx"
+sed 's/\r$//' $S/FlashOS.h > "$W/src/FlashOS.h"
+for f in $S/STM32H5xx/*.[ch]; do
+  sed -e 's/\r$//' -e 's|"\.\.\\|"../|' "$f" > "$W/src/STM32H5xx/$(basename "$f")"
+done
+$CC -O2 -pthread -Wall -Wextra -Wno-int-to-pointer-cast -DFLASH_HOST -DFLASH_MEM -DFLASH_EXT -DSTM32H5xx_2048_0x08 \
+    -I"$W/src/STM32H5xx" -o "$W/FlashPrgTest" FlashPrgTest.c Image.c
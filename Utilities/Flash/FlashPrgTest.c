@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Flash algorithm host test
+ *
+ * Runs the device code of CMSIS/Flash/STM32H5xx/FlashPrg.c (built with
+ * FLASH_HOST, see FlashPrgTest.sh) against a mocked register block. The
+ * flash and its secure alias, the FLASH and SBS registers, the flash size
+ * word, SRAM and the SAU are mapped at their device addresses. The
+ * registers never report busy or errors, erase does not change the flash
+ * content.
+ *
+ * Usage: FlashPrgTest prot
+ *          protection decode (ScanFlashProt/CheckFlashProt) against
+ *          option register settings, one line per case
+ *        FlashPrgTest stream
+ *          ProgramStream with a host thread filling the ring in SRAM,
+ *          invalid ring, abort and protected target
+ *        FlashPrgTest dump [-d file.dig] [-n] [-m outSize] [-c callSize] image file.fdmp
+ *          Dump of the image loaded to the 2M non-secure flash, in calls of
+ *          callSize (default: rest of the range), file as FlashDump encode
+ *        FlashPrgTest crc [-p page] image
+ *          programs the image with FlashCrcMode = 1 (ProgramPage, -p 16:
+ *          ProgramStream), prints FlashCrc and the chained CrcRange of the
+ *          programmed ranges, both must equal the FlashCrc tool total
+ *   exit status 0 - OK, 1 - failed, 2 - usage or memory map
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* Target instructions for the host build */
+#define DSB()           __sync_synchronize()
+#define NOP()           ((void)0)
+#define __disable_irq() ((void)0)
+
+#include "FlashPrg.c"
+#include "Image.h"
+
+#define DEV_BASE        0x08000000U     /* non-secure flash */
+#define DEV_BASE_S      0x0C000000U     /* secure alias */
+#define DEV_SIZE        0x00200000U     /* STM32H5xx_2048 */
+#define BANK_SIZE       (DEV_SIZE / 2U)
+#define SECT_SIZE       0x2000U
+
+#define SRAM_BASE       0x20000000U     /* ring buffer and dump output */
+#define SRAM_SIZE       0x00040000U
+#define SRAM_DIGEST     (SRAM_BASE + 0x0100U)   /* dump: control block at SRAM_BASE */
+#define SRAM_OUT        (SRAM_BASE + 0x1000U)
+
+#define TZEN_ON         0xB4000000U     /* OPTSR2 TZEN: TrustZone enabled */
+#define TZEN_OFF        0xC3000000U
+
+/* Map host memory at a device address, fd < 0: anonymous */
+static int Map (uint32_t adr, uint32_t size, int fd) {
+  void *p;
+  int   flags = (fd < 0) ? (MAP_PRIVATE | MAP_ANONYMOUS) : MAP_SHARED;
+
+#ifdef MAP_FIXED_NOREPLACE
+  flags |= MAP_FIXED_NOREPLACE;
+#endif
+  p = mmap((void *)(uintptr_t)adr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+  if (p != (void *)(uintptr_t)adr) {
+    fprintf(stderr, "Cannot map 0x%08X..0x%08X\n", (unsigned int)adr, (unsigned int)(adr + size - 1U));
+    return (1);
+  }
+  return (0);
+}
+
+/* Flash (both aliases share one file), registers, flash size word, SRAM, SAU */
+static int MapDevice (void) {
+  FILE *f = tmpfile();
+
+  if ((f == NULL) || (ftruncate(fileno(f), DEV_SIZE) != 0)) {
+    return (1);
+  }
+  return (Map(DEV_BASE,   DEV_SIZE, fileno(f)) ||
+          Map(DEV_BASE_S, DEV_SIZE, fileno(f)) ||
+          Map(FLASHSIZE_BASE & ~0xFFFU, 0x1000U, -1) ||
+          Map(FLASH_BASE     & ~0xFFFU, 0x1000U, -1) ||
+          Map(SBS_BASE       & ~0xFFFU, 0x1000U, -1) ||
+          Map(SRAM_BASE,                SRAM_SIZE, -1) ||
+          Map(0xE000E000U,              0x1000U, -1));
+}
+
+/* Registers after reset: nothing protected, flash erased */
+static void ResetDevice (uint32_t hdpl, uint32_t tzen, uint32_t swap) {
+  memset((void *)FLASH, 0, sizeof(FLASH_TypeDef));
+  memset((void *)(uintptr_t)DEV_BASE, 0xFF, DEV_SIZE);
+  M32(FLASHSIZE_BASE) = DEV_SIZE >> 10;
+  FLASH->WRP11R_CUR   = 0xFFFFFFFFU;
+  FLASH->WRP12R_CUR   = 0xFFFFFFFFU;
+  FLASH->WRP21R_CUR   = 0xFFFFFFFFU;
+  FLASH->WRP22R_CUR   = 0xFFFFFFFFU;
+  FLASH->HDP1R_CUR    = 0x000000FFU;                    /* start > end: no area */
+  FLASH->HDP2R_CUR    = 0x000000FFU;
+  FLASH->SECWM1R_CUR  = 0x000000FFU;
+  FLASH->SECWM2R_CUR  = 0x000000FFU;
+  FLASH->OPTSR2_PRG   = tzen;
+  FLASH->OPTSR_CUR    = (swap != 0U) ? FLASH_OPTSR_SWAP_BANK : 0U;
+  SBS->HDPLSR         = hdpl;
+}
+
+/* Protection cases: option registers, probed sector, expected result */
+typedef struct {
+  const char *name;
+  uint32_t    wrp1;                     /* protected WRP groups bank 1 (bit set = protected) */
+  uint32_t    wrp2;                     /* protected WRP groups bank 2 */
+  uint32_t    hdp1;                     /* HDP1R_CUR, 0 = no area */
+  uint32_t    hdp2;                     /* HDP2R_CUR, 0 = no area */
+  uint32_t    hdpExt;                   /* HDPEXTR */
+  uint32_t    secwm1;                   /* SECWM1R_CUR, 0 = no area */
+  uint32_t    edata2;                   /* EDATA2R_CUR */
+  uint32_t    swap;                     /* SWAP_BANK */
+  uint32_t    hdpl;                     /* SBS HDPLSR */
+  uint32_t    tzen;                     /* OPTSR2 TZEN */
+  uint32_t    base;                     /* Init address */
+  uint32_t    adr;                      /* probed sector */
+  uint32_t    reason;                   /* expected FlashProtReason */
+  uint32_t    bank;                     /* expected BKSEL of EraseSector (reason NONE) */
+} ProtCase_t;
+
+static const ProtCase_t ProtCase[] = {
+  /* name                               wrp1 wrp2 hdp1        hdp2        ext secwm1      edata2  swap hdpl        tzen      base        adr          reason            bank */
+  { "no protection",                    0U,  0U,  0U,         0U,         0U, 0U,         0U,     0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x08000000U, FLASH_PROT_NONE,  0U },
+  { "no protection, bank 2",            0U,  0U,  0U,         0U,         0U, 0U,         0U,     0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x081FE000U, FLASH_PROT_NONE,  1U },
+  { "no protection, swapped",           0U,  0U,  0U,         0U,         0U, 0U,         0U,     1U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x08002000U, FLASH_PROT_NONE,  1U },
+  { "WRP bank 1 group 0",               1U,  0U,  0U,         0U,         0U, 0U,         0U,     0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x08006000U, FLASH_PROT_WRP,   0U },
+  { "WRP bank 1 group 1 free",          1U,  0U,  0U,         0U,         0U, 0U,         0U,     0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x08008000U, FLASH_PROT_NONE,  0U },
+  { "WRP bank 2 group 0",               0U,  1U,  0U,         0U,         0U, 0U,         0U,     0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x08100000U, FLASH_PROT_WRP,   0U },
+  { "WRP bank 2, swapped",              0U,  1U,  0U,         0U,         0U, 0U,         0U,     1U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x08000000U, FLASH_PROT_WRP,   0U },
+  { "WRP bank 2, swapped, upper half",  0U,  1U,  0U,         0U,         0U, 0U,         0U,     1U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x08100000U, FLASH_PROT_NONE,  0U },
+  { "HDP at HDPL1",                     0U,  0U,  0x00030000, 0U,         0U, 0U,         0U,     0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x08000000U, FLASH_PROT_NONE,  0U },
+  { "HDP at HDPL2",                     0U,  0U,  0x00030000, 0U,         0U, 0U,         0U,     0U,  SBS_HDPL_2, TZEN_OFF, DEV_BASE,   0x08006000U, FLASH_PROT_HDP,   0U },
+  { "HDP at HDPL2, after area",         0U,  0U,  0x00030000, 0U,         0U, 0U,         0U,     0U,  SBS_HDPL_2, TZEN_OFF, DEV_BASE,   0x08008000U, FLASH_PROT_NONE,  0U },
+  { "HDP extension at HDPL2",           0U,  0U,  0x00030000, 0U,         2U, 0U,         0U,     0U,  SBS_HDPL_2, TZEN_OFF, DEV_BASE,   0x0800A000U, FLASH_PROT_NONE,  0U },
+  { "HDP extension at HDPL3",           0U,  0U,  0x00030000, 0U,         2U, 0U,         0U,     0U,  SBS_HDPL_3, TZEN_OFF, DEV_BASE,   0x0800A000U, FLASH_PROT_HDP,   0U },
+  { "HDP extension at HDPL3, after",    0U,  0U,  0x00030000, 0U,         2U, 0U,         0U,     0U,  SBS_HDPL_3, TZEN_OFF, DEV_BASE,   0x0800C000U, FLASH_PROT_NONE,  0U },
+  { "HDP at unknown level",             0U,  0U,  0x00030000, 0U,         0U, 0U,         0U,     0U,  0U,         TZEN_OFF, DEV_BASE,   0x08000000U, FLASH_PROT_HDP,   0U },
+  { "HDP bank 2 at HDPL2, swapped",     0U,  0U,  0U,         0x00030000, 0U, 0U,         0U,     1U,  SBS_HDPL_2, TZEN_OFF, DEV_BASE,   0x08000000U, FLASH_PROT_HDP,   0U },
+  { "HDP bank 2 at HDPL2, bank 1",      0U,  0U,  0U,         0x00030000, 0U, 0U,         0U,     1U,  SBS_HDPL_2, TZEN_OFF, DEV_BASE,   0x08100000U, FLASH_PROT_NONE,  0U },
+  { "SECWM, non-secure alias",          0U,  0U,  0U,         0U,         0U, 0x00070000, 0U,     0U,  SBS_HDPL_1, TZEN_ON,  DEV_BASE,   0x0800E000U, FLASH_PROT_SECWM, 0U },
+  { "SECWM, secure alias",              0U,  0U,  0U,         0U,         0U, 0x00070000, 0U,     0U,  SBS_HDPL_1, TZEN_ON,  DEV_BASE_S, 0x0C00E000U, FLASH_PROT_NONE,  0U },
+  { "SECWM without TrustZone",          0U,  0U,  0U,         0U,         0U, 0x00070000, 0U,     0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x0800E000U, FLASH_PROT_NONE,  0U },
+  { "EDATA bank 2",                     0U,  0U,  0U,         0U,         0U, 0U,         0x8001, 0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x081FC000U, FLASH_PROT_EDATA, 0U },
+  { "EDATA bank 2, before area",        0U,  0U,  0U,         0U,         0U, 0U,         0x8001, 0U,  SBS_HDPL_1, TZEN_OFF, DEV_BASE,   0x081FA000U, FLASH_PROT_NONE,  1U },
+};
+
+static int CmdProt (void) {
+  static const uint8_t data[16] = { 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U,
+                                    0x99U, 0xAAU, 0xBBU, 0xCCU, 0xDDU, 0xEEU, 0xFFU, 0x00U };
+  const ProtCase_t *c;
+  uint32_t i, cr, exp, sect, fail = 0U, ok;
+  int      rc;
+
+  for (i = 0U; i < (sizeof(ProtCase) / sizeof(ProtCase[0])); i++) {
+    c = &ProtCase[i];
+    ResetDevice(c->hdpl, c->tzen, c->swap);
+    FLASH->WRP11R_CUR = ~c->wrp1;
+    FLASH->WRP21R_CUR = ~c->wrp2;
+    if (c->hdp1 != 0U)   { FLASH->HDP1R_CUR   = c->hdp1; }
+    if (c->hdp2 != 0U)   { FLASH->HDP2R_CUR   = c->hdp2; }
+    if (c->secwm1 != 0U) { FLASH->SECWM1R_CUR = c->secwm1; }
+    FLASH->HDPEXTR     = c->hdpExt;
+    FLASH->EDATA2R_CUR = c->edata2;
+
+    (void)Init(c->base, 0U, 1U);
+    rc = EraseSector(c->adr);
+    cr = (c->tzen == TZEN_ON) ? FLASH->SECCR : FLASH->NSCR;
+    if (c->reason == FLASH_PROT_NONE) {
+      sect = ((c->adr - c->base) & (BANK_SIZE - 1U)) / SECT_SIZE;
+      exp  = FLASH_CR_SER | FLASH_CR_STRT | (sect << 6) | (c->bank << 31);
+      ok   = (rc == 0) && (FlashProtReason == FLASH_PROT_NONE) && (cr == exp);
+    } else {
+      ok   = (rc == 1) && (FlashProtReason == c->reason) && (FlashProtAdr == c->adr) && (cr == 0U);
+    }
+    (void)UnInit(1U);
+
+    printf("%s %s: reason %u, CR 0x%08X\n", ok ? "ok  " : "FAIL", c->name,
+           (unsigned int)FlashProtReason, (unsigned int)cr);
+    fail |= !ok;
+  }
+
+  /* ProgramPage writes free sectors and rejects a protected one untouched */
+  ResetDevice(SBS_HDPL_1, TZEN_OFF, 0U);
+  FLASH->WRP11R_CUR = ~2U;                              /* sectors 4..7 */
+  (void)Init(DEV_BASE, 0U, 2U);
+  ok = (ProgramPage(0x08000400U, sizeof(data), (unsigned char *)data) == 0) &&
+       (memcmp((void *)0x08000400U, data, sizeof(data)) == 0) &&
+       (memcmp((void *)0x0C000400U, data, sizeof(data)) == 0) &&
+       (ProgramPage(0x08008000U, sizeof(data), (unsigned char *)data) == 1) &&
+       (FlashProtReason == FLASH_PROT_WRP) && (M32(0x08008000U) == 0xFFFFFFFFU);
+  (void)UnInit(2U);
+  printf("%s ProgramPage\n", ok ? "ok  " : "FAIL");
+  fail |= !ok;
+
+  /* EraseChip fails on the first protected sector */
+  ResetDevice(SBS_HDPL_1, TZEN_OFF, 0U);
+  FLASH->WRP21R_CUR = ~(1U << 31);                      /* bank 2 sectors 124..127 */
+  (void)Init(DEV_BASE, 0U, 1U);
+  ok = (EraseChip() == 1) && (FlashProtReason == FLASH_PROT_WRP) && (FlashProtAdr == 0x081F8000U) &&
+       (FLASH->NSCR == 0U);
+  (void)UnInit(1U);
+  printf("%s EraseChip\n", ok ? "ok  " : "FAIL");
+  fail |= !ok;
+
+  return ((int)fail);
+}
+
+/* Test pattern, differs per quad-word */
+static uint8_t Pattern (uint32_t ofs) {
+  return ((uint8_t)((ofs * 13U) ^ (ofs >> 4) ^ 0x5AU));
+}
+
+/* Stream producer: the debugger writing the ring through memory access */
+typedef struct {
+  FlashStream_t *ring;
+  uint32_t       size;                  /* bytes to send, 0: abort */
+  uint32_t       step;                  /* bytes per refill */
+  const uint8_t *src;                   /* data, NULL: Pattern() */
+} Producer_t;
+
+static void *Producer (void *arg) {
+  const Producer_t *p    = arg;
+  FlashStream_t    *ring = p->ring;
+  unsigned char    *data = FLASH_STREAM_DATA(ring);
+  uint32_t          wr   = ring->wr, sent = 0U, n, i;
+
+  if (p->size == 0U) {
+    ring->cmd = FLASH_STREAM_ABORT;
+    return (NULL);
+  }
+  while (sent < p->size) {
+    n = (p->size - sent < p->step) ? (p->size - sent) : p->step;
+    while ((ring->size - (wr - ring->rd)) < n) {        /* wait for ring space */
+      if (ring->cmd == FLASH_STREAM_ABORT) {
+        return (NULL);                                  /* stream failed */
+      }
+      sched_yield();
+    }
+    for (i = 0U; i < n; i++) {
+      data[(wr + i) & (ring->size - 1U)] = (p->src != NULL) ? p->src[sent + i] : Pattern(sent + i);
+    }
+    __sync_synchronize();                               /* data before wr */
+    wr       += n;
+    ring->wr  = wr;
+    sent     += n;
+  }
+  return (NULL);
+}
+
+/* Run ProgramStream with a producer thread, ring at start of SRAM */
+static int Stream (uint32_t adr, uint32_t sz, uint32_t ringSize, uint32_t rd, uint32_t send, uint32_t step,
+                   const uint8_t *src) {
+  FlashStream_t *ring = (FlashStream_t *)(uintptr_t)SRAM_BASE;
+  Producer_t     p;
+  pthread_t      t;
+  int            rc;
+
+  memset(ring, 0, sizeof(*ring));
+  ring->wr   = rd;
+  ring->rd   = rd;
+  ring->size = ringSize;
+  p.ring = ring;
+  p.size = send;
+  p.step = step;
+  p.src  = src;
+  if (pthread_create(&t, NULL, Producer, &p) != 0) {
+    return (-1);
+  }
+  rc = ProgramStream(adr, sz, ring);
+  ring->cmd = FLASH_STREAM_ABORT;                       /* producer of a failed stream */
+  (void)pthread_join(t, NULL);
+  return (rc);
+}
+
+static int CmdStream (void) {
+  FlashStream_t *ring = (FlashStream_t *)(uintptr_t)SRAM_BASE;
+  uint32_t       i, fail = 0U, ok;
+  int            rc;
+
+  /* 64K through a 4K ring in odd refill steps, indices wrapping at 2^32 */
+  ResetDevice(SBS_HDPL_1, TZEN_OFF, 0U);
+  (void)Init(DEV_BASE, 0U, 2U);
+  rc = Stream(0x08010000U, 0x10000U, 0x1000U, 0xFFFFF800U, 0x10000U, 0x130U, NULL);
+  ok = (rc == 0) && (ring->state == FLASH_STREAM_DONE) && (ring->rd == 0xFFFFF800U + 0x10000U);
+  for (i = 0U; ok && (i < 0x10000U); i++) {
+    ok = (*(volatile uint8_t *)(uintptr_t)(0x08010000U + i) == Pattern(i));
+  }
+  ok = ok && (M32(0x08020000U) == 0xFFFFFFFFU) && (M32(0x0800FFFCU) == 0xFFFFFFFFU);
+  (void)UnInit(2U);
+  printf("%s stream 64K, 4K ring, wrapping indices\n", ok ? "ok  " : "FAIL");
+  fail |= !ok;
+
+  /* size not a multiple of 16: last quad-word padded by the host */
+  ResetDevice(SBS_HDPL_1, TZEN_OFF, 0U);
+  (void)Init(DEV_BASE, 0U, 2U);
+  rc = Stream(0x08000000U, 40U, 0x100U, 0U, 48U, 48U, NULL);
+  ok = (rc == 0) && (ring->state == FLASH_STREAM_DONE) && (ring->rd == 48U) &&
+       (*(volatile uint8_t *)0x0800002FU == Pattern(47U)) && (M32(0x08000030U) == 0xFFFFFFFFU);
+  (void)UnInit(2U);
+  printf("%s stream padded to a quad-word\n", ok ? "ok  " : "FAIL");
+  fail |= !ok;
+
+  /* invalid rings are rejected before any write */
+  ResetDevice(SBS_HDPL_1, TZEN_OFF, 0U);
+  (void)Init(DEV_BASE, 0U, 2U);
+  ok = (Stream(0x08000000U, 64U, 0x100U, 8U,  0U, 16U, NULL) == 1) && (ring->state == FLASH_STREAM_ERROR) &&
+       (ring->errAdr == 0x08000000U) &&
+       (Stream(0x08000000U, 64U, 0x0C0U, 0U,  0U, 16U, NULL) == 1) && (ring->state == FLASH_STREAM_ERROR) &&
+       (Stream(0x08000008U, 64U, 0x100U, 0U,  0U, 16U, NULL) == 1) && (ring->state == FLASH_STREAM_ERROR) &&
+       (M32(0x08000000U) == 0xFFFFFFFFU) && (FLASH->NSCR == 0U);
+  (void)UnInit(2U);
+  printf("%s stream rejects misaligned rd, ring size, address\n", ok ? "ok  " : "FAIL");
+  fail |= !ok;
+
+  /* abort while waiting for data */
+  ResetDevice(SBS_HDPL_1, TZEN_OFF, 0U);
+  (void)Init(DEV_BASE, 0U, 2U);
+  rc = Stream(0x08000000U, 64U, 0x100U, 0U, 0U, 16U, NULL);
+  ok = (rc == 1) && (ring->state == FLASH_STREAM_ABORTED) && (ring->rd == 0U) && (FLASH->NSCR == 0U);
+  (void)UnInit(2U);
+  printf("%s stream abort\n", ok ? "ok  " : "FAIL");
+  fail |= !ok;
+
+  /* protected sector fails before the first quad-word */
+  ResetDevice(SBS_HDPL_1, TZEN_OFF, 0U);
+  FLASH->WRP11R_CUR = ~2U;                              /* sectors 4..7 */
+  (void)Init(DEV_BASE, 0U, 2U);
+  rc = Stream(0x08006000U, 0x4000U, 0x1000U, 0U, 0U, 16U, NULL);
+  ok = (rc == 1) && (ring->state == FLASH_STREAM_ERROR) && (ring->errAdr == 0x08008000U) &&
+       (FlashProtReason == FLASH_PROT_WRP) && (M32(0x08006000U) == 0xFFFFFFFFU);
+  (void)UnInit(2U);
+  printf("%s stream into WRP sector\n", ok ? "ok  " : "FAIL");
+  fail |= !ok;
+
+  return ((int)fail);
+}
+
+/* Load image content within the non-secure flash range */
+static int LoadFlash (const char *path) {
+  Image_t  img;
+  uint32_t i, j, adr;
+
+  if (Image_Load(&img, path, DEV_BASE) != 0) {
+    return (1);
+  }
+  for (i = 0U; i < img.nSeg; i++) {
+    for (j = 0U; j < img.seg[i].size; j++) {
+      adr = img.seg[i].adr + j;
+      if ((adr >= DEV_BASE) && (adr < (DEV_BASE + DEV_SIZE))) {
+        *(volatile uint8_t *)(uintptr_t)adr = img.seg[i].data[j];
+      }
+    }
+  }
+  Image_Free(&img);
+  return (0);
+}
+
+static void Wr32 (uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+static int CmdDump (int argc, char *argv[]) {
+  FlashDump_t *ctl = (FlashDump_t *)(uintptr_t)SRAM_BASE;
+  const char  *dig = NULL, *arg[2] = { NULL, NULL };
+  uint32_t     outSize = 4096U, callSize = 0U, flags = FLASH_DUMP_LZ, nArg = 0U;
+  uint32_t     adr, sz, next, total = 0U, calls = 0U;
+  uint8_t      hdr[16];
+  FILE        *f;
+  int          i, ret = 0;
+
+  for (i = 2; i < argc; i++) {
+    if ((strcmp(argv[i], "-d") == 0) && ((i + 1) < argc)) {
+      dig = argv[++i];
+    } else if ((strcmp(argv[i], "-m") == 0) && ((i + 1) < argc)) {
+      outSize = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-c") == 0) && ((i + 1) < argc)) {
+      callSize = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "-n") == 0) {
+      flags &= ~FLASH_DUMP_LZ;
+    } else if ((argv[i][0] != '-') && (nArg < 2U)) {
+      arg[nArg++] = argv[i];
+    } else {
+      nArg = 0U;
+      break;
+    }
+  }
+  if ((nArg != 2U) || (outSize > (SRAM_BASE + SRAM_SIZE - SRAM_OUT))) {
+    return (-1);
+  }
+
+  ResetDevice(SBS_HDPL_1, TZEN_OFF, 0U);
+  memset(ctl, 0, sizeof(*ctl));
+  if (dig != NULL) {                                    /* digest list from FlashDump digest */
+    f = fopen(dig, "rb");
+    if (f == NULL) {
+      fprintf(stderr, "Cannot read %s\n", dig);
+      return (1);
+    }
+    ctl->nDigest = (uint32_t)fread((void *)(uintptr_t)SRAM_DIGEST, 4U, (SRAM_OUT - SRAM_DIGEST) / 4U, f);
+    fclose(f);
+  }
+  if (LoadFlash(arg[0]) != 0) {
+    fprintf(stderr, "Cannot read %s\n", arg[0]);
+    return (1);
+  }
+  ctl->base    = DEV_BASE;
+  ctl->digest  = SRAM_DIGEST;
+  ctl->out     = SRAM_OUT;
+  ctl->outSize = outSize;
+  ctl->flags   = flags;
+
+  f = fopen(arg[1], "wb");
+  if (f == NULL) {
+    return (1);
+  }
+  memcpy(hdr, "FDMP", 4U);
+  Wr32(&hdr[4],  DEV_BASE);
+  Wr32(&hdr[8],  DEV_SIZE);
+  Wr32(&hdr[12], FLASH_DUMP_SECTOR);
+  (void)Init(DEV_BASE, 0U, 3U);
+  ret = (fwrite(hdr, 1U, sizeof(hdr), f) != sizeof(hdr));
+  for (adr = DEV_BASE; (ret == 0) && (adr < (DEV_BASE + DEV_SIZE)); adr = next) {
+    sz = (DEV_BASE + DEV_SIZE) - adr;
+    if ((callSize != 0U) && (sz > callSize)) {
+      sz = callSize;
+    }
+    next = (uint32_t)Dump(adr, sz, ctl);
+    if ((next == adr) || (ctl->outLen > outSize) ||
+        (fwrite((void *)(uintptr_t)SRAM_OUT, 1U, ctl->outLen, f) != ctl->outLen)) {
+      ret = 1;
+    }
+    total += ctl->outLen;
+    calls++;
+  }
+  (void)UnInit(3U);
+  if (fclose(f) != 0) {
+    ret = 1;
+  }
+  printf("Dump 0x%08X..0x%08X: %u bytes, %u calls\n",
+         (unsigned int)DEV_BASE, (unsigned int)(DEV_BASE + DEV_SIZE - 1U), (unsigned int)total, (unsigned int)calls);
+  return (ret);
+}
+
+/* Program an image as the debugger does with FlashCrcMode = 1: ranges padded
+   to page boundaries in address order, one session per flash alias, the
+   debugger chains FlashCrc into the next session. The secure alias part runs
+   with TrustZone enabled and its sectors in the secure watermark area. */
+static int CmdCrc (int argc, char *argv[]) {
+  Image_t   img;
+  const char *path = NULL;
+  uint32_t  page = 1024U, tzen = TZEN_OFF, secEnd = 0U, alias = 0U, crc = 0U, chk = 0U;
+  uint32_t  i, next, start, end, a;
+  uint8_t  *buf;
+  int       rc = 0;
+
+  for (i = 2U; i < (uint32_t)argc; i++) {
+    if ((strcmp(argv[i], "-p") == 0) && ((i + 1U) < (uint32_t)argc)) {
+      page = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if ((argv[i][0] != '-') && (path == NULL)) {
+      path = argv[i];
+    } else {
+      path = NULL;
+      break;
+    }
+  }
+  if ((path == NULL) || (page < 16U) || (page > 1024U) || ((page & (page - 1U)) != 0U)) {
+    return (-1);
+  }
+  if (Image_Load(&img, path, DEV_BASE) != 0) {
+    fprintf(stderr, "Cannot read %s\n", path);
+    return (1);
+  }
+  for (i = 0U; i < img.nSeg; i++) {
+    a = img.seg[i].adr & ~(DEV_SIZE - 1U);
+    if (((a != DEV_BASE) && (a != DEV_BASE_S)) || (((img.seg[i].adr - a) + img.seg[i].size) > DEV_SIZE) ||
+        ((a == DEV_BASE_S) && (((img.seg[i].adr - a) + img.seg[i].size) > BANK_SIZE))) {
+      fprintf(stderr, "0x%08X: outside the flash (secure alias: bank 1)\n", (unsigned int)img.seg[i].adr);
+      Image_Free(&img);
+      return (1);
+    }
+    if (a == DEV_BASE_S) {
+      tzen   = TZEN_ON;
+      secEnd = img.seg[i].adr + img.seg[i].size - DEV_BASE_S;
+    }
+  }
+  ResetDevice(SBS_HDPL_1, tzen, 0U);
+  if (secEnd != 0U) {
+    FLASH->SECWM1R_CUR = ((secEnd - 1U) / SECT_SIZE) << FLASH_AREA_END_POS;
+  }
+
+  for (i = 0U; (rc == 0) && (i < img.nSeg); i = next) {
+    /* segments sharing a page form one range, as FlashCrc */
+    start = img.seg[i].adr & ~(page - 1U);
+    end   = (img.seg[i].adr + img.seg[i].size + (page - 1U)) & ~(page - 1U);
+    for (next = i + 1U; (next < img.nSeg) && (img.seg[next].adr < end); next++) {
+      end = (img.seg[next].adr + img.seg[next].size + (page - 1U)) & ~(page - 1U);
+    }
+    buf = malloc(end - start);
+    if (buf == NULL) {
+      rc = 1;
+      break;
+    }
+    memset(buf, 0xFF, end - start);
+    for (a = i; a < next; a++) {
+      memcpy(&buf[img.seg[a].adr - start], img.seg[a].data, img.seg[a].size);
+    }
+
+    if ((start & ~(DEV_SIZE - 1U)) != alias) {          /* new session, chain FlashCrc */
+      if (alias != 0U) {
+        crc = FlashCrc;
+        (void)UnInit(2U);
+      }
+      alias = start & ~(DEV_SIZE - 1U);
+      (void)Init(alias, 0U, 2U);
+      FlashCrc     = crc;
+      FlashCrcMode = 1U;
+    }
+    if (page == 16U) {
+      rc = Stream(start, end - start, 0x1000U, 0U, end - start, 0x130U, buf);
+    } else {
+      for (a = start; (rc == 0) && (a < end); a += page) {
+        rc = ProgramPage(a, page, &buf[a - start]);
+      }
+    }
+    chk = (uint32_t)CrcRange(start, end - start, chk);
+    free(buf);
+  }
+  crc = FlashCrc;
+  (void)UnInit(2U);
+  Image_Free(&img);
+
+  if (rc != 0) {
+    fprintf(stderr, "%s failed at 0x%08X, reason %u\n", (page == 16U) ? "ProgramStream" : "ProgramPage",
+            (unsigned int)FlashProtAdr, (unsigned int)FlashProtReason);
+    return (1);
+  }
+  printf("0x%08X 0x%08X\n", (unsigned int)crc, (unsigned int)chk);
+  return (0);
+}
+
+int main (int argc, char *argv[]) {
+  int (*cmd)(void) = NULL;
+  int   ret = -1;
+
+  if (argc == 2) {
+    if      (strcmp(argv[1], "prot")   == 0) { cmd = CmdProt;   }
+    else if (strcmp(argv[1], "stream") == 0) { cmd = CmdStream; }
+  }
+  if ((cmd != NULL) || ((argc > 2) && ((strcmp(argv[1], "dump") == 0) || (strcmp(argv[1], "crc") == 0)))) {
+    if (MapDevice() != 0) {
+      return (2);
+    }
+    if (cmd != NULL) {
+      ret = cmd();
+    } else {
+      ret = (strcmp(argv[1], "dump") == 0) ? CmdDump(argc, argv) : CmdCrc(argc, argv);
+    }
+  }
+  if (ret < 0) {
+    fprintf(stderr, "Usage: %s prot|stream\n"
+                    "       %s dump [-d file.dig] [-n] [-m outSize] [-c callSize] image file.fdmp\n"
+                    "       %s crc [-p page] image\n", argv[0], argv[0], argv[0]);
+    return (2);
+  }
+  return (ret);
+}
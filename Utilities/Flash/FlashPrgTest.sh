@@ -0,0 +1,40 @@
+#!/bin/sh
+#
+# Copyright (c) 2026 Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Flash algorithm host test
+#
+# Builds CMSIS/Flash/STM32H5xx/FlashPrg.c for the host (FlashPrgBuild.sh)
+# and runs it against the mocked register block:
+#  - protection decode for option register settings (WRP, HDP levels,
+#    secure watermark, EDATA, SWAP_BANK)
+#  - ProgramStream fed by a producer thread, invalid rings, abort
+#
+# Usage: ./FlashPrgTest.sh [work dir]
+
+set -e
+cd "$(dirname "$0")"
+W=${1:-${TMPDIR:-/tmp}/FlashPrgTest}
+
+./FlashPrgBuild.sh "$W"
+
+fail=0
+for cmd in prot stream; do
+  "$W/FlashPrgTest" $cmd || fail=1
+done
+exit $fail
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FlmDevice.h"
+
+/* ELF32 little-endian field access */
+static uint16_t Rd16 (const uint8_t *p) {
+  return ((uint16_t)(p[0] | (p[1] << 8)));
+}
+
+static uint32_t Rd32 (const uint8_t *p) {
+  return ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+/* Read complete file into memory */
+static uint8_t *ReadFile (const char *path, uint32_t *size) {
+  FILE    *f;
+  uint8_t *buf = NULL;
+  long     len;
+
+  f = fopen(path, "rb");
+  if (f == NULL) {
+    return (NULL);
+  }
+  if ((fseek(f, 0, SEEK_END) == 0) && ((len = ftell(f)) > 0) && (fseek(f, 0, SEEK_SET) == 0)) {
+    buf = malloc((size_t)len);
+    if ((buf != NULL) && (fread(buf, 1U, (size_t)len, f) != (size_t)len)) {
+      free(buf);
+      buf = NULL;
+    }
+    *size = (uint32_t)len;
+  }
+  fclose(f);
+  return (buf);
+}
+
+/* Layout of 'struct FlashDevice' as built for Cortex-M (32-bit unsigned long) */
+#define FD_VERS         0U
+#define FD_DEVNAME      2U
+#define FD_DEVTYPE      130U
+#define FD_DEVADR       132U
+#define FD_SZDEV        136U
+#define FD_SZPAGE       140U
+#define FD_VALEMPTY     148U
+#define FD_TOPROG       152U
+#define FD_TOERASE      156U
+#define FD_SECTORS      160U
+
+int FlmDevice_Load (const char *path, FlmDevice_t *dev) {
+  uint8_t       *elf;
+  uint32_t       size, shoff, shnum, shentsize, i, j;
+  const uint8_t *sh, *sym, *str, *fd = NULL;
+  uint32_t       symOff, symSize, strOff, strSize;
+  int            ret = 1;
+
+  elf = ReadFile(path, &size);
+  if (elf == NULL) {
+    return (1);
+  }
+  if ((size < 52U) || (memcmp(elf, "\177ELF", 4) != 0) || (elf[4] != 1U) || (elf[5] != 1U)) {
+    goto exit;                                          /* not ELF32 little-endian */
+  }
+
+  shoff     = Rd32(&elf[32]);
+  shentsize = Rd16(&elf[46]);
+  shnum     = Rd16(&elf[48]);
+  if ((shentsize < 40U) || (shoff > size) || ((shnum * shentsize) > (size - shoff))) {
+    goto exit;
+  }
+
+  /* Find symbol 'FlashDevice' in .symtab and map it to its section data */
+  for (i = 0U; (i < shnum) && (fd == NULL); i++) {
+    sh = &elf[shoff + (i * shentsize)];
+    if (Rd32(&sh[4]) != 2U) {                           /* SHT_SYMTAB */
+      continue;
+    }
+    symOff  = Rd32(&sh[16]);
+    symSize = Rd32(&sh[20]);
+    j       = Rd32(&sh[24]);                            /* sh_link: string table */
+    if ((j >= shnum) || (symOff > size) || (symSize > (size - symOff))) {
+      continue;
+    }
+    strOff  = Rd32(&elf[shoff + (j * shentsize) + 16U]);
+    strSize = Rd32(&elf[shoff + (j * shentsize) + 20U]);
+    if ((strOff > size) || (strSize > (size - strOff))) {
+      continue;
+    }
+    str = &elf[strOff];
+
+    for (j = 0U; (j + 16U) <= symSize; j += 16U) {
+      uint32_t name, value, shndx;
+      const uint8_t *tsh;
+
+      sym   = &elf[symOff + j];
+      name  = Rd32(&sym[0]);
+      value = Rd32(&sym[4]);
+      shndx = Rd16(&sym[14]);
+      if ((name >= strSize) || (strncmp((const char *)&str[name], "FlashDevice", strSize - name) != 0) ||
+          (shndx == 0U) || (shndx >= shnum)) {
+        continue;
+      }
+      tsh = &elf[shoff + (shndx * shentsize)];
+      /* file offset = section offset + (symbol address - section address) */
+      value = Rd32(&tsh[16]) + (value - Rd32(&tsh[12]));
+      if ((value < size) && ((size - value) >= FD_SECTORS)) {
+        fd   = &elf[value];
+        size = size - value;                            /* remaining bytes for sector list */
+      }
+      break;
+    }
+  }
+  if (fd == NULL) {
+    goto exit;
+  }
+
+  memset(dev, 0, sizeof(*dev));
+  dev->vers     = Rd16(&fd[FD_VERS]);
+  memcpy(dev->devName, &fd[FD_DEVNAME], sizeof(dev->devName) - 1U);
+  dev->devType  = Rd16(&fd[FD_DEVTYPE]);
+  dev->devAdr   = Rd32(&fd[FD_DEVADR]);
+  dev->szDev    = Rd32(&fd[FD_SZDEV]);
+  dev->szPage   = Rd32(&fd[FD_SZPAGE]);
+  dev->valEmpty = fd[FD_VALEMPTY];
+  dev->toProg   = Rd32(&fd[FD_TOPROG]);
+  dev->toErase  = Rd32(&fd[FD_TOERASE]);
+
+  for (i = 0U; (i < FLM_SECTOR_NUM) && ((FD_SECTORS + (i * 8U) + 8U) <= size); i++) {
+    uint32_t sz  = Rd32(&fd[FD_SECTORS + (i * 8U)]);
+    uint32_t adr = Rd32(&fd[FD_SECTORS + (i * 8U) + 4U]);
+
+    if ((sz == 0xFFFFFFFFU) && (adr == 0xFFFFFFFFU)) {  /* SECTOR_END */
+      break;
+    }
+    dev->sectors[i].szSector   = sz;
+    dev->sectors[i].addrSector = adr;
+  }
+  dev->nSectors = i;
+
+  if ((dev->nSectors != 0U) && (dev->szDev != 0U) && (dev->szPage != 0U)) {
+    ret = 0;
+  }
+
+exit:
+  free(elf);
+  return (ret);
+}
+
+void FlmDevice_Default (FlmDevice_t *dev, uint32_t devAdr, uint32_t szDev) {
+  memset(dev, 0, sizeof(*dev));
+  snprintf(dev->devName, sizeof(dev->devName), "STM32H5xx %uK %s Flash",
+           (unsigned int)(szDev >> 10), ((devAdr & 0x04000000U) != 0U) ? "Secure" : "NSecure");
+  dev->vers     = 0x0101U;
+  dev->devType  = 1U;                                   /* ONCHIP */
+  dev->devAdr   = devAdr;
+  dev->szDev    = szDev;
+  dev->szPage   = 1024U;
+  dev->valEmpty = 0xFFU;
+  dev->toProg   = 400U;
+  dev->toErase  = 400U;
+  dev->nSectors = 1U;
+  dev->sectors[0].szSector   = 0x2000U;
+  dev->sectors[0].addrSector = 0U;
+}
+
+uint32_t FlmDevice_Sector (const FlmDevice_t *dev, uint32_t adr, uint32_t *size) {
+  uint32_t ofs, i, end, sz;
+
+  *size = 0U;
+  if ((adr < dev->devAdr) || ((adr - dev->devAdr) >= dev->szDev)) {
+    return (0U);
+  }
+  ofs = adr - dev->devAdr;
+
+  /* sector item i covers [addrSector(i), addrSector(i+1)) or up to szDev */
+  for (i = 0U; i < dev->nSectors; i++) {
+    end = ((i + 1U) < dev->nSectors) ? dev->sectors[i + 1U].addrSector : dev->szDev;
+    sz  = dev->sectors[i].szSector;
+    if ((ofs >= dev->sectors[i].addrSector) && (ofs < end) && (sz != 0U)) {
+      *size = sz;
+      return (dev->devAdr + ofs - ((ofs - dev->sectors[i].addrSector) % sz));
+    }
+  }
+  return (0U);
+}
+
+uint32_t FlmDevice_SectorCount (const FlmDevice_t *dev) {
+  uint32_t i, end, n = 0U;
+
+  for (i = 0U; i < dev->nSectors; i++) {
+    end = ((i + 1U) < dev->nSectors) ? dev->sectors[i + 1U].addrSector : dev->szDev;
+    if (dev->sectors[i].szSector != 0U) {
+      n += (end - dev->sectors[i].addrSector) / dev->sectors[i].szSector;
+    }
+  }
+  return (n);
+}
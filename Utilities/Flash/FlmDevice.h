@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLM_DEVICE_H_
+#define FLM_DEVICE_H_
+
+#include <stdint.h>
+
+#define FLM_SECTOR_NUM  512U            /* Max Number of Sector Items (FlashOS.h SECTOR_NUM) */
+
+/* Host copy of 'struct FlashDevice' (FlashOS.h) read from a .FLM file */
+typedef struct {
+  uint16_t vers;                        /* Version Number and Architecture */
+  char     devName[128];                /* Device Name and Description */
+  uint16_t devType;                     /* Device Type: ONCHIP, ... */
+  uint32_t devAdr;                      /* Default Device Start Address */
+  uint32_t szDev;                       /* Total Size of Device */
+  uint32_t szPage;                      /* Programming Page Size */
+  uint8_t  valEmpty;                    /* Content of Erased Memory */
+  uint32_t toProg;                      /* Time Out of Program Page Function (ms) */
+  uint32_t toErase;                     /* Time Out of Erase Sector Function (ms) */
+  uint32_t nSectors;                    /* Number of sector items */
+  struct {
+    uint32_t szSector;                  /* Sector Size in Bytes */
+    uint32_t addrSector;                /* Address of Sector (offset to devAdr) */
+  } sectors[FLM_SECTOR_NUM];
+} FlmDevice_t;
+
+/* Read FlashDevice description from a .FLM (ELF) file
+     Return Value: 0 - OK, 1 - Failed */
+extern int FlmDevice_Load (const char *path, FlmDevice_t *dev);
+
+/* Fill FlashDevice description of an on-chip STM32H5 flash with 8K sectors
+   (same content as FlashDev.c), used when no .FLM is given */
+extern void FlmDevice_Default (FlmDevice_t *dev, uint32_t devAdr, uint32_t szDev);
+
+/* Sector containing an address
+     Return Value: sector start address, *size = sector size (0 if outside) */
+extern uint32_t FlmDevice_Sector (const FlmDevice_t *dev, uint32_t adr, uint32_t *size);
+
+/* Total number of sectors */
+extern uint32_t FlmDevice_SectorCount (const FlmDevice_t *dev);
+
+#endif /* FLM_DEVICE_H_ */
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Firmware image reader
+ *
+ * Reads the loadable content of ELF32 (PT_LOAD segments at their
+ * physical address, as placed by the linker into flash), Intel HEX
+ * (records 00, 01, 02, 04) and raw binary files into a list of
+ * address sorted segments.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Image.h"
+
+static uint16_t Rd16 (const uint8_t *p) {
+  return ((uint16_t)(p[0] | (p[1] << 8)));
+}
+
+static uint32_t Rd32 (const uint8_t *p) {
+  return ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+/* Read complete file into memory */
+static uint8_t *ReadFile (const char *path, uint32_t *size) {
+  FILE    *f;
+  uint8_t *buf = NULL;
+  long     len;
+
+  f = fopen(path, "rb");
+  if (f == NULL) {
+    return (NULL);
+  }
+  if ((fseek(f, 0, SEEK_END) == 0) && ((len = ftell(f)) > 0) && (fseek(f, 0, SEEK_SET) == 0)) {
+    buf = malloc((size_t)len);
+    if ((buf != NULL) && (fread(buf, 1U, (size_t)len, f) != (size_t)len)) {
+      free(buf);
+      buf = NULL;
+    }
+    *size = (uint32_t)len;
+  }
+  fclose(f);
+  return (buf);
+}
+
+int Image_Add (Image_t *img, uint32_t adr, const uint8_t *data, uint32_t size) {
+  ImageSeg_t *seg;
+  uint8_t    *buf;
+  uint32_t    i, j, start, end, s, e;
+
+  if (size == 0U) {
+    return (0);
+  }
+  if ((uint64_t)adr + size > 0x100000000ULL) {
+    return (1);
+  }
+  start = adr;
+  end   = adr + size;                                   /* 0 on wrap to 4 GB is excluded above */
+
+  /* Record continuing the last segment (HEX, ELF sections in order): grow in place */
+  if (img->nSeg != 0U) {
+    seg = &img->seg[img->nSeg - 1U];
+    if ((seg->adr + seg->size) == adr) {
+      buf = realloc(seg->data, seg->size + size);
+      if (buf == NULL) {
+        return (1);
+      }
+      memcpy(&buf[seg->size], data, size);
+      seg->data  = buf;
+      seg->size += size;
+      return (0);
+    }
+  }
+
+  /* Merge all segments that overlap or touch [start, end) into one */
+  for (i = 0U; i < img->nSeg; i++) {
+    s = img->seg[i].adr;
+    e = s + img->seg[i].size;
+    if ((s <= end) && (e >= start)) {
+      if (s < start) { start = s; }
+      if (e > end)   { end   = e; }
+    }
+  }
+
+  buf = malloc(end - start);
+  if (buf == NULL) {
+    return (1);
+  }
+  for (i = 0U, j = 0U; i < img->nSeg; i++) {
+    seg = &img->seg[i];
+    if ((seg->adr >= start) && ((seg->adr + seg->size) <= end)) {
+      memcpy(&buf[seg->adr - start], seg->data, seg->size);
+      free(seg->data);
+    } else {
+      img->seg[j++] = *seg;
+    }
+  }
+  memcpy(&buf[adr - start], data, size);
+
+  seg = realloc(img->seg, (j + 1U) * sizeof(ImageSeg_t));
+  if (seg == NULL) {
+    free(buf);
+    img->nSeg = j;
+    return (1);
+  }
+  img->seg = seg;
+  for (i = j; (i > 0U) && (seg[i - 1U].adr > start); i--) {
+    seg[i] = seg[i - 1U];                               /* keep sorted */
+  }
+  seg[i].adr  = start;
+  seg[i].size = end - start;
+  seg[i].data = buf;
+  img->nSeg   = j + 1U;
+  return (0);
+}
+
+void Image_Free (Image_t *img) {
+  uint32_t i;
+
+  for (i = 0U; i < img->nSeg; i++) {
+    free(img->seg[i].data);
+  }
+  free(img->seg);
+  img->seg  = NULL;
+  img->nSeg = 0U;
+}
+
+static int LoadElf (Image_t *img, const uint8_t *elf, uint32_t size) {
+  uint32_t phoff, phnum, phentsize, i;
+  const uint8_t *ph;
+
+  if ((size < 52U) || (elf[4] != 1U) || (elf[5] != 1U)) {
+    return (1);                                         /* not ELF32 little-endian */
+  }
+  phoff     = Rd32(&elf[28]);
+  phentsize = Rd16(&elf[42]);
+  phnum     = Rd16(&elf[44]);
+  if ((phentsize < 32U) || (phoff > size) || ((phnum * phentsize) > (size - phoff))) {
+    return (1);
+  }
+  for (i = 0U; i < phnum; i++) {
+    ph = &elf[phoff + (i * phentsize)];
+    if ((Rd32(&ph[0]) != 1U) || (Rd32(&ph[16]) == 0U)) {
+      continue;                                         /* PT_LOAD with file content only */
+    }
+    if ((Rd32(&ph[4]) > size) || (Rd32(&ph[16]) > (size - Rd32(&ph[4])))) {
+      return (1);
+    }
+    if (Image_Add(img, Rd32(&ph[12]), &elf[Rd32(&ph[4])], Rd32(&ph[16])) != 0) {
+      return (1);
+    }
+  }
+  return (0);
+}
+
+static int HexVal (const uint8_t *p, uint32_t n, uint32_t *val) {
+  uint32_t i, c;
+
+  *val = 0U;
+  for (i = 0U; i < n; i++) {
+    c = p[i];
+    if      ((c >= '0') && (c <= '9')) { c -= '0'; }
+    else if ((c >= 'A') && (c <= 'F')) { c -= 'A' - 10U; }
+    else if ((c >= 'a') && (c <= 'f')) { c -= 'a' - 10U; }
+    else    { return (1); }
+    *val = (*val << 4) | c;
+  }
+  return (0);
+}
+
+static int LoadHex (Image_t *img, const uint8_t *hex, uint32_t size) {
+  uint8_t  rec[255];
+  uint32_t pos = 0U, len, ofs, type, sum, val, i;
+  uint32_t base = 0U;
+
+  while (pos < size) {
+    if (hex[pos] != ':') {
+      pos++;                                            /* line ends, white space */
+      continue;
+    }
+    if (((size - pos) < 11U) || (HexVal(&hex[pos + 1U], 2U, &len) != 0) ||
+        ((size - pos) < (11U + (len * 2U)))) {
+      return (1);
+    }
+    (void)HexVal(&hex[pos + 3U], 4U, &ofs);
+    (void)HexVal(&hex[pos + 7U], 2U, &type);
+    sum = len + (ofs >> 8) + (ofs & 0xFFU) + type;
+    for (i = 0U; i <= len; i++) {                       /* data and checksum */
+      if (HexVal(&hex[pos + 9U + (i * 2U)], 2U, &val) != 0) {
+        return (1);
+      }
+      if (i < len) {
+        rec[i] = (uint8_t)val;
+      }
+      sum += val;
+    }
+    if ((sum & 0xFFU) != 0U) {
+      return (1);                                       /* checksum error */
+    }
+    pos += 11U + (len * 2U);
+
+    switch (type) {
+      case 0x00U:                                       /* Data */
+        if (Image_Add(img, base + ofs, rec, len) != 0) {
+          return (1);
+        }
+        break;
+      case 0x01U:                                       /* End of File */
+        return (0);
+      case 0x02U:                                       /* Extended Segment Address */
+        base = (len == 2U) ? ((((uint32_t)rec[0] << 8) | rec[1]) << 4) : base;
+        break;
+      case 0x04U:                                       /* Extended Linear Address */
+        base = (len == 2U) ? ((((uint32_t)rec[0] << 8) | rec[1]) << 16) : base;
+        break;
+      default:                                          /* Start address records */
+        break;
+    }
+  }
+  return (0);
+}
+
+int Image_Load (Image_t *img, const char *path, uint32_t binAdr) {
+  uint8_t  *buf;
+  uint32_t  size = 0U;
+  int       ret;
+
+  img->nSeg = 0U;
+  img->seg  = NULL;
+
+  buf = ReadFile(path, &size);
+  if (buf == NULL) {
+    return (1);
+  }
+  if ((size >= 4U) && (memcmp(buf, "\177ELF", 4) == 0)) {
+    ret = LoadElf(img, buf, size);
+  } else if (buf[0] == ':') {
+    ret = LoadHex(img, buf, size);
+  } else {
+    ret = Image_Add(img, binAdr, buf, size);
+  }
+  free(buf);
+  if (ret != 0) {
+    Image_Free(img);
+  }
+  return (ret);
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IMAGE_H_
+#define IMAGE_H_
+
+#include <stdint.h>
+
+typedef struct {
+  uint32_t adr;                         /* Load address */
+  uint32_t size;                        /* Size in bytes */
+  uint8_t *data;
+} ImageSeg_t;
+
+typedef struct {
+  uint32_t    nSeg;
+  ImageSeg_t *seg;                      /* Sorted by address, contiguous data merged */
+} Image_t;
+
+/* Load image, format is detected from the content:
+     ELF32 (PT_LOAD segments at their physical address), Intel HEX,
+     otherwise binary loaded at binAdr
+     Return Value: 0 - OK, 1 - Failed */
+extern int  Image_Load (Image_t *img, const char *path, uint32_t binAdr);
+extern void Image_Free (Image_t *img);
+
+/* Add data to image, overlapping data replaces existing content
+     Return Value: 0 - OK, 1 - Failed */
+extern int  Image_Add  (Image_t *img, uint32_t adr, const uint8_t *data, uint32_t size);
+
+#endif /* IMAGE_H_ */